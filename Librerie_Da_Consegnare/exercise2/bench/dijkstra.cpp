@@ -0,0 +1,252 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+/* ************************************************************************** */
+
+#include "../zlasdtest/container/container.hpp"
+
+#include "../pq/heap/pqheap.hpp"
+#include "../pq/indexed/indexedpqheap.hpp"
+#include "../pq/pairing/pqpairing.hpp"
+#include "../pq/radix/pqradix.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Dijkstra su un grafo casuale (10 archi uscenti per nodo, pesi in [1, 1000]) con quattro code:
+// MinPQHeap e PQRadix con inserimenti duplicati e scarto dei nodi gia' chiusi, MinIndexedPQHeap e
+// MinPQPairing con decrease-key sugli handle.
+// Uso: ./bench_dijkstra [archi] (default 10^7)
+
+struct Graph {
+
+    vector<ulong> first; // Archi uscenti dal nodo u: [first[u], first[u + 1])
+    vector<uint32_t> target;
+    vector<uint32_t> weight;
+
+};
+
+Graph RandomGraph(ulong nodes, ulong edges)
+{
+    Graph graph;
+    ulong seed = 12345;
+
+    graph.first.resize(nodes + 1);
+    graph.target.resize(edges);
+    graph.weight.resize(edges);
+
+    for(ulong u = 0; u <= nodes; u++)
+        graph.first[u] = u * edges / nodes;
+
+    for(ulong e = 0; e < edges; e++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        graph.target[e] = static_cast<uint32_t>((seed >> 33) % nodes);
+        graph.weight[e] = static_cast<uint32_t>((seed >> 20) % 1000) + 1;
+    }
+
+    return graph;
+}
+
+template <typename Fun>
+double Seconds(Fun fun)
+{
+    auto start = chrono::steady_clock::now();
+    fun();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+using Entry = pair<ulong, ulong>; // (distanza, nodo)
+
+constexpr ulong Unreached = ~0UL;
+
+vector<ulong> LazyHeap(const Graph &graph, ulong &operations)
+{
+    ulong nodes = graph.first.size() - 1;
+    vector<ulong> dist(nodes, Unreached);
+    vector<bool> done(nodes, false);
+    lasd::MinPQHeap<Entry, 4> pq;
+
+    dist[0] = 0;
+    pq.Insert({0, 0});
+
+    while(!pq.Empty())
+    {
+        auto [d, u] = pq.TipNRemove();
+
+        if(done[u])
+            continue;
+
+        done[u] = true;
+
+        for(ulong e = graph.first[u]; e < graph.first[u + 1]; e++)
+        {
+            ulong v = graph.target[e];
+
+            if(d + graph.weight[e] < dist[v])
+            {
+                dist[v] = d + graph.weight[e];
+                pq.Insert({dist[v], v});
+                operations++;
+            }
+        }
+    }
+
+    return dist;
+}
+
+vector<ulong> Radix(const Graph &graph, ulong &operations)
+{
+    ulong nodes = graph.first.size() - 1;
+    vector<ulong> dist(nodes, Unreached);
+    vector<bool> done(nodes, false);
+    lasd::PQRadix<ulong, ulong> pq;
+
+    dist[0] = 0;
+    pq.Insert({0, 0});
+
+    while(!pq.Empty())
+    {
+        auto [d, u] = pq.TipNRemove();
+
+        if(done[u])
+            continue;
+
+        done[u] = true;
+
+        for(ulong e = graph.first[u]; e < graph.first[u + 1]; e++)
+        {
+            ulong v = graph.target[e];
+
+            if(d + graph.weight[e] < dist[v])
+            {
+                dist[v] = d + graph.weight[e];
+                pq.Insert({dist[v], v});
+                operations++;
+            }
+        }
+    }
+
+    return dist;
+}
+
+vector<ulong> IndexedHeap(const Graph &graph, ulong &operations)
+{
+    ulong nodes = graph.first.size() - 1;
+    vector<ulong> dist(nodes, Unreached);
+    vector<ulong> handle(nodes, 0);
+    vector<bool> queued(nodes, false);
+    lasd::MinIndexedPQHeap<Entry, 4> pq;
+
+    dist[0] = 0;
+    handle[0] = pq.Insert({0, 0});
+    queued[0] = true;
+
+    while(!pq.Empty())
+    {
+        auto [d, u] = pq.TipNRemove();
+        queued[u] = false;
+
+        for(ulong e = graph.first[u]; e < graph.first[u + 1]; e++)
+        {
+            ulong v = graph.target[e];
+
+            if(d + graph.weight[e] < dist[v])
+            {
+                dist[v] = d + graph.weight[e];
+
+                if(queued[v])
+                    pq.Change(handle[v], Entry {dist[v], v});
+                else
+                {
+                    handle[v] = pq.Insert({dist[v], v});
+                    queued[v] = true;
+                }
+
+                operations++;
+            }
+        }
+    }
+
+    return dist;
+}
+
+vector<ulong> Pairing(const Graph &graph, ulong &operations)
+{
+    ulong nodes = graph.first.size() - 1;
+    vector<ulong> dist(nodes, Unreached);
+    vector<lasd::MinPQPairing<Entry>::Handle> handle(nodes);
+    lasd::MinPQPairing<Entry> pq;
+
+    dist[0] = 0;
+    handle[0] = pq.Push({0, 0});
+
+    while(!pq.Empty())
+    {
+        auto [d, u] = pq.TipNRemove();
+
+        for(ulong e = graph.first[u]; e < graph.first[u + 1]; e++)
+        {
+            ulong v = graph.target[e];
+
+            if(d + graph.weight[e] < dist[v])
+            {
+                dist[v] = d + graph.weight[e];
+
+                if(pq.Contains(handle[v]))
+                    pq.Change(handle[v], Entry {dist[v], v});
+                else
+                    handle[v] = pq.Push({dist[v], v});
+
+                operations++;
+            }
+        }
+    }
+
+    return dist;
+}
+
+template <typename Fun>
+void Run(const char * name, const Graph &graph, Fun fun, const vector<ulong> * ref)
+{
+    vector<ulong> dist;
+    ulong operations = 0;
+
+    double time = Seconds([&] { dist = fun(graph, operations); });
+
+    ulong check = 0;
+    for(ulong d : dist)
+        check += (d != Unreached) ? d : 0;
+
+    cout << name << "\t" << time << "\t" << operations << "\t" << check;
+    if(ref != nullptr && dist != *ref)
+        cout << "\tMISMATCH";
+    cout << endl;
+}
+
+int main(int argc, char ** argv)
+{
+    ulong edges = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000UL;
+    ulong nodes = max(edges / 10, 2UL);
+
+    Graph graph = RandomGraph(nodes, edges);
+    ulong dummy = 0;
+    vector<ulong> ref = LazyHeap(graph, dummy);
+
+    cout << nodes << " nodes, " << edges << " edges" << endl;
+    cout << "Queue\t\t\tSeconds\tUpdates\tChecksum" << endl;
+
+    Run("MinPQHeap<4> (lazy)", graph, LazyHeap, nullptr);
+    Run("PQRadix (lazy)\t", graph, Radix, &ref);
+    Run("MinIndexedPQHeap<4>", graph, IndexedHeap, &ref);
+    Run("MinPQPairing\t", graph, Pairing, &ref);
+
+    return 0;
+}
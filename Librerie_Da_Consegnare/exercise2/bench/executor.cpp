@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/* ************************************************************************** */
+
+#include "../zlasdtest/container/container.hpp"
+
+#include "../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Costo di Spawn/Sync e quicksort fork/join al variare dei thread.
+// Uso: ./bench_executor [elementi da ordinare] [thread massimi]
+
+template <typename Fun>
+double Seconds(Fun fun)
+{
+    auto start = chrono::steady_clock::now();
+    fun();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Albero binario di task vuoti: 2^depth foglie
+void Tree(lasd::Executor &exec, ulong depth)
+{
+    if(depth == 0)
+        return;
+
+    lasd::Executor::TaskGroup group;
+
+    exec.Spawn(group, [&exec, depth] { Tree(exec, depth - 1); });
+    Tree(exec, depth - 1);
+    exec.Sync(group);
+}
+
+int main(int argc, char ** argv)
+{
+    ulong length = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000UL;
+    ulong maxThreads = (argc > 2) ? strtoul(argv[2], nullptr, 10) : max(thread::hardware_concurrency(), 1U);
+
+    lasd::SortableVector<long> source(length);
+    ulong seed = 12345;
+
+    for(ulong i = 0; i < length; i++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        source[i] = static_cast<long>(seed >> 33);
+    }
+
+    cout << "Elements: " << length << endl;
+    cout << "Threads\tSpawn+Sync flat (ns/task)\tSpawn+Sync tree (ns/task)\tSort (s)\tSort speedup" << endl;
+
+    double base = 0.0;
+
+    for(ulong threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        lasd::Executor exec(threads - 1);
+        const ulong tasks = 1UL << 18;
+
+        double flat = Seconds([&] {
+            lasd::Executor::TaskGroup group;
+
+            for(ulong i = 0; i < tasks; i++)
+                exec.Spawn(group, [] {});
+
+            exec.Sync(group);
+        });
+
+        double tree = Seconds([&] { Tree(exec, 18); });
+
+        lasd::SortableVector<long> vec(source);
+        double sort = Seconds([&] { vec.Sort(exec); });
+
+        base = (threads == 1) ? sort : base;
+
+        cout << threads << "\t" << flat * 1e9 / tasks << "\t" << tree * 1e9 / tasks << "\t" << sort << "\t" << base / sort << endl;
+    }
+
+    // Riferimento: std::sort sequenziale sugli stessi dati
+    {
+        lasd::SortableVector<long> vec(source);
+        long * first = &vec[0];
+
+        cout << "std::sort (s): " << Seconds([&] { std::sort(first, first + length); }) << endl;
+    }
+
+    return 0;
+}
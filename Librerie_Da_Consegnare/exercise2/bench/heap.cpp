@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/* ************************************************************************** */
+
+#include "../zlasdtest/container/container.hpp"
+
+#include "../pq/heap/pqheap.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Throughput di Insert e RemoveTip su PQHeap per arieta' 2, 4 e 8.
+// Uso: ./bench_heap [elementi massimi] (da 10^6 a salire di un fattore 10; default 10^7)
+
+template <typename Fun>
+double Seconds(Fun fun)
+{
+    auto start = chrono::steady_clock::now();
+    fun();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+template <ulong Arity>
+void Run(ulong length)
+{
+    lasd::PQHeap<long, Arity> pq;
+    ulong seed = 12345;
+    long check = 0;
+
+    double push = Seconds([&] {
+        for(ulong i = 0; i < length; i++)
+        {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            pq.Insert(static_cast<long>(seed >> 33));
+        }
+    });
+
+    double pop = Seconds([&] {
+        for(ulong i = 0; i < length; i++)
+        {
+            check ^= pq.Tip();
+            pq.RemoveTip();
+        }
+    });
+
+    cout << length << "\t" << Arity << "\t" << length / push / 1e6 << "\t" << length / pop / 1e6 << "\t(" << check << ")" << endl;
+}
+
+int main(int argc, char ** argv)
+{
+    ulong maxLength = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000UL;
+
+    cout << "Elements\tArity\tInsert (M/s)\tRemoveTip (M/s)" << endl;
+
+    for(ulong length = 1000000; length <= maxLength; length *= 10)
+    {
+        Run<2>(length);
+        Run<4>(length);
+        Run<8>(length);
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/* ************************************************************************** */
+
+#include "../zlasdtest/container/container.hpp"
+
+#include "../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Scalabilita' di ParallelFold, ParallelMap e ParallelExists al variare dei thread.
+// Uso: ./bench_parallel [elementi] [thread massimi]
+
+template <typename Fun>
+double Seconds(Fun fun)
+{
+    auto start = chrono::steady_clock::now();
+    fun();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char ** argv)
+{
+    ulong length = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 50000000UL;
+    ulong maxThreads = (argc > 2) ? strtoul(argv[2], nullptr, 10) : max(thread::hardware_concurrency(), 1U);
+
+    lasd::Vector<double> vec(length);
+
+    for(ulong i = 0; i < length; i++)
+        vec[i] = static_cast<double>(i % 1000);
+
+    cout << "Elements: " << length << endl;
+    cout << "Threads\tFold (s)\tMap (s)\tExists (s)\tFold speedup" << endl;
+
+    double base = 0.0;
+
+    for(ulong threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        lasd::Executor exec(threads - 1);
+        double sum = 0.0;
+
+        double fold = Seconds([&] {
+            sum = vec.ParallelFold<double>([] (const double &dat, const double &acc) { return acc + dat; },
+                                           [] (const double &left, const double &right) { return left + right; }, 0.0, exec);
+        });
+
+        double map = Seconds([&] { vec.ParallelMap([] (double &dat) { dat = dat * 0.5 + 1.0; }, exec); });
+
+        double exists = Seconds([&] { sum += vec.ParallelExists(-1.0, exec); });
+
+        base = (threads == 1) ? fold : base;
+
+        cout << threads << "\t" << fold << "\t" << map << "\t" << exists << "\t" << base / fold << "\t(" << sum << ")" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/* ************************************************************************** */
+
+#include "../zlasdtest/container/container.hpp"
+
+#include "../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// StableSort (TimSort) contro Sort (quicksort fork/join) e std::stable_sort al variare
+// dell'ordinamento dell'input: un array crescente in cui una frazione (100 - sortedness)% di
+// posizioni casuali riceve un valore casuale. Ultima riga: lo stesso array decrescente.
+// Uso: ./bench_sort [elementi] (default 10^7)
+
+template <typename Fun>
+double Seconds(Fun fun)
+{
+    auto start = chrono::steady_clock::now();
+    fun();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void Run(const lasd::SortableVector<long> &input, const char * label)
+{
+    ulong length = input.Size();
+
+    lasd::SortableVector<long> stable(input);
+    lasd::SortableVector<long> quick(input);
+    std::vector<long> standard(length);
+
+    for(ulong i = 0; i < length; i++)
+        standard[i] = input[i];
+
+    double timsort = Seconds([&] { stable.StableSort(); });
+    double quicksort = Seconds([&] { quick.Sort(); });
+    double stdsort = Seconds([&] { std::stable_sort(standard.begin(), standard.end()); });
+
+    cout << label << "\t" << timsort << "\t" << quicksort << "\t" << stdsort << "\t" << (stable == quick ? "ok" : "MISMATCH") << endl;
+}
+
+int main(int argc, char ** argv)
+{
+    ulong length = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000UL;
+
+    cout << "Sorted (%)\tStableSort (s)\tSort (s)\tstd::stable_sort (s)" << endl;
+
+    for(ulong sortedness : {0UL, 50UL, 90UL, 99UL, 100UL})
+    {
+        lasd::SortableVector<long> input(length);
+        ulong seed = 12345 + sortedness;
+
+        for(ulong i = 0; i < length; i++)
+        {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            input[i] = ((seed >> 33) % 100 < sortedness) ? static_cast<long>(i) : static_cast<long>((seed >> 20) % length);
+        }
+
+        Run(input, to_string(sortedness).c_str());
+    }
+
+    lasd::SortableVector<long> reversed(length);
+
+    for(ulong i = 0; i < length; i++)
+        reversed[i] = static_cast<long>(length - i);
+
+    Run(reversed, "reversed");
+
+    return 0;
+}
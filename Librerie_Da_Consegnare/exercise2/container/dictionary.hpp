@@ -112,6 +112,14 @@ public:
   virtual Data SuccessorNRemove(const Data &) = 0; // (concrete function must throw std::length_error when not found)
   virtual void RemoveSuccessor(const Data &) = 0; // (concrete function must throw std::length_error when not found)
 
+  using RangeFun = std::function<void(const Data &)>;
+  virtual void TraverseRange(const Data &, const Data &, RangeFun) const = 0; // Keys in [first, last], in ascending order
+  virtual ulong CountRange(const Data &, const Data &) const = 0; // Number of keys in [first, last]
+  virtual ulong RemoveRange(const Data &, const Data &) = 0; // Removes the keys in [first, last] and returns how many they were
+
+  virtual ulong Rank(const Data &) const = 0; // Number of keys smaller than the given one
+  virtual const Data & Select(ulong) const = 0; // Key of the given rank, starting from 0 (concrete function must throw std::out_of_range when out of range)
+
 };
 
 /* ************************************************************************** */
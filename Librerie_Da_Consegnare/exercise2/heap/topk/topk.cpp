@@ -0,0 +1,228 @@
+#include <algorithm>
+
+#include "topk.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------TopK: Constructors/Destructors -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+TopK<Data, Arity, Compare>::TopK(ulong k) : Vector<Data>(k)
+{
+    capacity = size;
+    size = 0;
+}
+
+// The k greatest elements of a TraversableContainer
+template <typename Data, ulong Arity, typename Compare>
+TopK<Data, Arity, Compare>::TopK(ulong k, const TraversableContainer<Data> &cont) : TopK(k)
+{
+    PushAll(cont);
+}
+
+// Copy constructor
+template <typename Data, ulong Arity, typename Compare>
+TopK<Data, Arity, Compare>::TopK(const TopK &topk) : Vector<Data>(topk.capacity)
+{
+    capacity = size;
+    size = topk.size;
+
+    for(ulong i = 0; i < size; i++)
+        Elements[i] = topk.Elements[i];
+}
+
+// Move constructor
+template <typename Data, ulong Arity, typename Compare>
+TopK<Data, Arity, Compare>::TopK(TopK &&topk) noexcept : Vector<Data>(std::move(topk))
+{
+    std::swap(capacity, topk.capacity);
+}
+
+/* ---------------------------TopK: Assignments -------------------------- */
+
+// Copy assignment
+template <typename Data, ulong Arity, typename Compare>
+TopK<Data, Arity, Compare> & TopK<Data, Arity, Compare>::operator=(const TopK &topk)
+{
+    TopK<Data, Arity, Compare> * tmp = new TopK<Data, Arity, Compare>(topk);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, ulong Arity, typename Compare>
+TopK<Data, Arity, Compare> & TopK<Data, Arity, Compare>::operator=(TopK &&topk) noexcept
+{
+    Vector<Data>::operator=(std::move(topk));
+    std::swap(capacity, topk.capacity);
+
+    return *this;
+}
+
+/* ---------------------------TopK: Comparison Operators-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+bool TopK<Data, Arity, Compare>::operator==(const TopK &topk) const noexcept
+{
+    return capacity == topk.capacity && Vector<Data>::operator==(topk);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool TopK<Data, Arity, Compare>::operator!=(const TopK &topk) const noexcept
+{
+    return !((*this) == topk);
+}
+
+/* ---------------------------TopK: Specific member functions -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong TopK<Data, Arity, Compare>::K() const noexcept
+{
+    return capacity;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline const Data & TopK<Data, Arity, Compare>::Threshold() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: TopK is empty");
+
+    return Elements[0];
+}
+
+// Finche' ci sono meno di k elementi il nuovo sale dal fondo; poi sostituisce la radice solo se
+// la supera (compare e' invertito: compare(value, radice) vuol dire radice < value)
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::Push(const Data &value)
+{
+    if(size < capacity)
+    {
+        Elements[size++] = value;
+        HeapifyUp(size - 1);
+    }
+    else if(size > 0 && compare(value, Elements[0]))
+    {
+        Elements[0] = value;
+        HeapifyDown(size, 0);
+    }
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::Push(Data &&value)
+{
+    if(size < capacity)
+    {
+        Elements[size++] = std::move(value);
+        HeapifyUp(size - 1);
+    }
+    else if(size > 0 && compare(value, Elements[0]))
+    {
+        Elements[0] = std::move(value);
+        HeapifyDown(size, 0);
+    }
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::PushAll(const TraversableContainer<Data> &cont)
+{
+    cont.Traverse
+    (
+        [this] (const Data &curr)
+        {
+            Push(curr);
+        }
+    );
+}
+
+// Come ParallelFold: qualche blocco in piu' dei thread, ognuno con il proprio TopK, poi
+// fusi nell'ordine dei blocchi (al piu' k elementi ciascuno)
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::PushAll(const Vector<Data> &vec, Executor &exec)
+{
+    ulong length = vec.Size();
+
+    if(length == 0 || capacity == 0)
+        return;
+
+    ulong chunks = std::max(std::min(4 * exec.Threads(), length / Vector<Data>::ParallelGrain), 1UL);
+    const Data * elements = &vec[0]; // Blocchi contigui, senza passare per operator[] a ogni elemento
+    ulong k = capacity;
+
+    TopK * partials = new TopK[chunks];
+
+    try
+    {
+        exec.ParallelFor(chunks, [elements, length, chunks, k, partials] (ulong chunk) {
+            TopK local(k);
+            ulong last = length * (chunk + 1) / chunks;
+
+            for(ulong i = length * chunk / chunks; i < last; i++)
+                local.Push(elements[i]);
+
+            partials[chunk] = std::move(local);
+        });
+    }
+    catch(...)
+    {
+        delete[] partials;
+        throw;
+    }
+
+    for(ulong i = 0; i < chunks; i++)
+        Merge(std::move(partials[i]));
+
+    delete[] partials;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::Merge(const TopK &topk)
+{
+    for(ulong i = 0; i < topk.size; i++)
+        Push(topk.Elements[i]);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::Merge(TopK &&topk)
+{
+    if(&topk == this)
+        return;
+
+    for(ulong i = 0; i < topk.size; i++)
+        Push(std::move(topk.Elements[i]));
+
+    topk.Clear();
+}
+
+// HeapSort in ordine crescente secondo il comparatore invertito: dal piu' grande al piu' piccolo
+template <typename Data, ulong Arity, typename Compare>
+SortableVector<Data> TopK<Data, Arity, Compare>::Result() const
+{
+    TopK sorted(*this);
+    sorted.HeapSort();
+
+    SortableVector<Data> result(size);
+
+    for(ulong i = 0; i < size; i++)
+        result[i] = std::move(sorted.Elements[i]);
+
+    return result;
+}
+
+/* ---------------------------TopK: Specific member function (inherited from ClearableContainer) -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+void TopK<Data, Arity, Compare>::Clear()
+{
+    delete[] Elements;
+    Elements = new Data[capacity] {};
+    size = 0;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,134 @@
+
+#ifndef TOPK_HPP
+#define TOPK_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../vec/heapvec.hpp"
+#include "../../parallel/executor.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Order of a comparator read backwards: a heap ordered by it keeps the smallest element in the root
+template <typename Compare>
+struct ReverseOrder {
+
+  [[no_unique_address]] Compare compare;
+
+  template <typename Data>
+  inline bool operator()(const Data &fst, const Data &snd) const { return compare(snd, fst); }
+
+};
+
+/* ************************************************************************** */
+
+// The k greatest elements (according to Compare) of a stream: a heap of at most k elements with
+// the smallest of them in the root, which a new element replaces only when it is greater.
+// O(k) memory and O(n log k) time; most elements of a long stream cost one comparison.
+// Equal elements at the boundary are kept in no particular order.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class TopK : virtual public ClearableContainer,
+             virtual protected HeapVec<Data, Arity, ReverseOrder<Compare>> {
+  // Must extend ClearableContainer,
+  // Could extend HeapVec<Data, Arity>
+
+private:
+
+
+protected:
+
+  using Container::size;
+  using HeapVec<Data, Arity, ReverseOrder<Compare>>::Elements;
+  using HeapVec<Data, Arity, ReverseOrder<Compare>>::HeapifyDown;
+  using HeapVec<Data, Arity, ReverseOrder<Compare>>::HeapifyUp;
+  using HeapVec<Data, Arity, ReverseOrder<Compare>>::HeapSort;
+  using HeapVec<Data, Arity, ReverseOrder<Compare>>::compare;
+
+  ulong capacity = 0; // k
+
+public:
+
+  // Default constructor
+  TopK() = default; // (k = 0: keeps nothing)
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  explicit TopK(ulong); // The k greatest elements of an empty stream
+  TopK(ulong, const TraversableContainer<Data> &); // The k greatest elements of a TraversableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  TopK(const TopK &);
+
+  // Move constructor
+  TopK(TopK &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~TopK() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  TopK & operator=(const TopK &);
+
+  // Move assignment
+  TopK & operator=(TopK &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const TopK &) const noexcept; // (same k and same elements in the same positions)
+  inline bool operator!=(const TopK &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong K() const noexcept;
+
+  inline const Data & Threshold() const; // The smallest element kept (must throw std::length_error when empty)
+
+  void Push(const Data &); // Copy of the value
+  void Push(Data &&); // Move of the value
+
+  void PushAll(const TraversableContainer<Data> &);
+  void PushAll(const Vector<Data> &, Executor & = Executor::Default()); // (one TopK per block of the vector in parallel, then merged)
+
+  void Merge(const TopK &); // Adds the elements of another TopK (the k greatest of both streams)
+  void Merge(TopK &&);
+
+  SortableVector<Data> Result() const; // The elements kept, from the greatest
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member (k stays)
+
+};
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity = 2>
+using BottomK = TopK<Data, Arity, std::greater<Data>>;
+
+/* ************************************************************************** */
+
+}
+
+#include "topk.cpp"
+
+#endif
@@ -1,3 +1,4 @@
+#include <bit>
 
 namespace lasd {
 
@@ -6,32 +7,32 @@ namespace lasd {
 /* ---------------------------HeapVec: Constructors/Destructors -------------------------- */
 
 // A heap obtained from a TraversableContainer
-template <typename Data>
-HeapVec<Data>::HeapVec(const TraversableContainer<Data> &cont) : Vector<Data>::Vector(cont)
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(const TraversableContainer<Data> &cont) : Vector<Data>::Vector(cont)
 {
     Heapify();
 }
 
 // A heap obtained from a MappableContainer
-template <typename Data>
-HeapVec<Data>::HeapVec(MappableContainer<Data> &&cont) : Vector<Data>::Vector(std::move(cont))
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(MappableContainer<Data> &&cont) : Vector<Data>::Vector(std::move(cont))
 {
     Heapify();
 }
 
 // Copy constructor
-template <typename Data>
-HeapVec<Data>::HeapVec(const HeapVec<Data> &hvec) : Vector<Data>::Vector(hvec), SortableVector<Data>::SortableVector(hvec) {}
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(const HeapVec<Data, Arity, Compare> &hvec) : Vector<Data>::Vector(hvec), SortableVector<Data>::SortableVector(hvec) {}
 
 // Move constructor
-template <typename Data>
-HeapVec<Data>::HeapVec(HeapVec<Data> &&hvec) noexcept : Vector<Data>::Vector(std::move(hvec)) {}
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(HeapVec<Data, Arity, Compare> &&hvec) noexcept : Vector<Data>::Vector(std::move(hvec)) {}
 
 /* ---------------------------HeapVec: Assignments -------------------------- */
 
 // Copy assignment
-template <typename Data>
-HeapVec<Data> & HeapVec<Data>::operator=(const HeapVec<Data> &hvec)
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare> & HeapVec<Data, Arity, Compare>::operator=(const HeapVec<Data, Arity, Compare> &hvec)
 {
     SortableVector<Data>::operator=(hvec);
 
@@ -39,8 +40,8 @@ HeapVec<Data> & HeapVec<Data>::operator=(const HeapVec<Data> &hvec)
 }
 
 // Move assignment
-template <typename Data>
-HeapVec<Data> & HeapVec<Data>::operator=(HeapVec<Data> &&hvec) noexcept
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare> & HeapVec<Data, Arity, Compare>::operator=(HeapVec<Data, Arity, Compare> &&hvec) noexcept
 {
     SortableVector<Data>::operator=(std::move(hvec));
 
@@ -49,80 +50,242 @@ HeapVec<Data> & HeapVec<Data>::operator=(HeapVec<Data> &&hvec) noexcept
 
 /* ---------------------------HeapVec: Comparison Operators-------------------------- */
 
-template <typename Data>
-bool HeapVec<Data>::operator==(const HeapVec<Data> &hvec) const noexcept
+template <typename Data, ulong Arity, typename Compare>
+bool HeapVec<Data, Arity, Compare>::operator==(const HeapVec<Data, Arity, Compare> &hvec) const noexcept
 {
     return SortableVector<Data>::operator==(hvec);
 }
 
-template <typename Data>
-inline bool HeapVec<Data>::operator!=(const HeapVec<Data> &hvec) const noexcept
+template <typename Data, ulong Arity, typename Compare>
+inline bool HeapVec<Data, Arity, Compare>::operator!=(const HeapVec<Data, Arity, Compare> &hvec) const noexcept
 {
     return !((*this) == hvec);
 }
 
-/* ---------------------------HeapVec: Specific member functions (inherited from Heap)-------------------------- */
+/* ---------------------------HeapVec: Specific member function -------------------------- */
 
-template <typename Data>
-bool HeapVec<Data>::IsHeap() const noexcept
+// Il heap non viene toccato: si estraggono k nodi da una frontiera (un piccolo heap di indici con lo stesso ordine)
+// che parte dalla radice e a ogni estrazione riceve i figli del nodo estratto: O(k log k)
+template <typename Data, ulong Arity, typename Compare>
+const Data & HeapVec<Data, Arity, Compare>::KthLargest(ulong k) const
 {
-    if(size > 1)
+    if(k >= size)
+        throw std::out_of_range("Out Of Range Exception from HeapVec");
+
+    ulong * frontier = new ulong[k * (Arity - 1) + 2];
+    ulong length = 1;
+    frontier[0] = 0;
+
+    for(ulong step = 0; step < k; step++)
+    {
+        ulong top = frontier[0];
+
+        // Estraggo la radice della frontiera
+        frontier[0] = frontier[--length];
+        for(ulong i = 0, max = 0; ; i = max)
+        {
+            ulong fsx = 2 * i + 1;
+            ulong fdx = 2 * i + 2;
+
+            if(fsx < length && compare(Elements[frontier[max]], Elements[frontier[fsx]]))
+                max = fsx;
+            if(fdx < length && compare(Elements[frontier[max]], Elements[frontier[fdx]]))
+                max = fdx;
+            if(max == i)
+                break;
+
+            std::swap(frontier[i], frontier[max]);
+        }
+
+        // Inserisco i figli del nodo estratto
+        for(ulong child = FirstChild(top); child < FirstChild(top) + Arity && child < size; child++)
         {
-            for(ulong i = 0; i < size/2; i++)
+            ulong i = length++;
+            frontier[i] = child;
+
+            while(i > 0 && compare(Elements[frontier[(i - 1) / 2]], Elements[frontier[i]]))
             {
-                ulong fsx = 2 * i + 1;
-                ulong fdx = 2 * i + 2;
-
-                if(Elements[fsx] > Elements[i])
-                    return false;
-                
-                if(fdx < size && Elements[fdx] > Elements[i])
-                    return false;  
+                std::swap(frontier[(i - 1) / 2], frontier[i]);
+                i = (i - 1) / 2;
             }
         }
+    }
+
+    const Data & kth = Elements[frontier[0]];
+    delete[] frontier;
+
+    return kth;
+}
+
+/* ---------------------------HeapVec: Specific member functions (inherited from Heap)-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+bool HeapVec<Data, Arity, Compare>::IsHeap() const noexcept
+{
+    for(ulong i = 1; i < size; i++)
+        if(compare(Elements[Parent(i)], Elements[i]))
+            return false;
+
     return true; 
 } 
 
-template <typename Data>
-void HeapVec<Data>::Heapify() noexcept
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::Heapify() noexcept
 {
-    for(ulong i = size/2; i > 0; i--)
-        HeapifyDown(size, i-1);
+    Heapify(Executor::Default());
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::Heapify(Executor &exec) noexcept
+{
+    if(size < HeapGrain || exec.Threads() == 1)
+    {
+        for(ulong i = Internal(size); i > 0; i--)
+            HeapifyDown(size, i-1);
+    }
+    else
+        ParallelHeapify(0, exec);
 }
 
 /* ---------------------------HeapVec: Specific member function (inherited from SortableLinearContainer)-------------------------- */
 
-template <typename Data>
-inline void HeapVec<Data>::Sort() noexcept
+template <typename Data, ulong Arity, typename Compare>
+inline void HeapVec<Data, Arity, Compare>::Sort() noexcept
 {
     HeapSort();
 }
 
 /* ---------------------------HeapVec: Auxilary functions -------------------------- */
 
-template <typename Data>
-void HeapVec<Data>::HeapifyDown(ulong length, ulong root) noexcept
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::HeapifyDown(ulong length, ulong root) noexcept
 {
-    ulong max = root;
+    Data value = std::move(Elements[root]);
+    ulong hole = root;
+    ulong first;
+
+    while((first = FirstChild(hole)) < length)
+    {
+        ulong max = first;
+        ulong last = std::min(first + Arity, length);
 
-    ulong fsx = 2 * root + 1;
-    ulong fdx = 2 * root + 2;
+        for(ulong child = first + 1; child < last; child++)
+            if(compare(Elements[max], Elements[child]))
+                max = child;
 
-    if(fsx < length && Elements[fsx] > Elements[max] )
-            max = fsx;
+        if(!compare(value, Elements[max]))
+            break;
 
-    if(fdx < length && Elements[fdx] > Elements[max] )
-            max = fdx;
+        Elements[hole] = std::move(Elements[max]);
+        hole = max;
+    }
 
-    if(root != max)
-        {
-            std::swap(Elements[root], Elements[max]);
-            HeapifyDown(length, max);
-        }
+    Elements[hole] = std::move(value);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::HeapifyUp(ulong index, ulong top) noexcept
+{
+    Data value = std::move(Elements[index]);
+
+    while(index > top && compare(Elements[Parent(index)], value))
+    {
+        Elements[index] = std::move(Elements[Parent(index)]);
+        index = Parent(index);
+    }
+
+    Elements[index] = std::move(value);
+}
+
+// Floyd: il valore che riempie la radice arriva quasi sempre da una foglia e torna in basso,
+// quindi si scende fino a una foglia senza confrontarlo (un confronto in meno per livello)
+// e poi lo si fa risalire, di solito di pochi livelli
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::FloydDown(ulong length, Data &&value) noexcept
+{
+    ulong hole = 0;
+    ulong first;
+
+    while((first = FirstChild(hole)) < length)
+    {
+        ulong max = first;
+        ulong last = std::min(first + Arity, length);
+
+        for(ulong child = first + 1; child < last; child++)
+            if(compare(Elements[max], Elements[child]))
+                max = child;
+
+        Elements[hole] = std::move(Elements[max]);
+        hole = max;
+    }
+
+    Elements[hole] = std::move(value);
+    HeapifyUp(hole);
+}
+
+// Heapify bottom-up limitato al sottoalbero di root: i discendenti a distanza l occupano
+// un intervallo contiguo [first, last), e quelli a distanza l + 1 sono [Arity * first + 1, Arity * last + 1)
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::HeapifySubtree(ulong root) noexcept
+{
+    ulong firsts[64], lasts[64];
+    ulong levels = 0;
+
+    for(ulong first = root, last = root + 1; first < Internal(size); first = FirstChild(first), last = FirstChild(last))
+    {
+        firsts[levels] = first;
+        lasts[levels++] = std::min(last, Internal(size));
+    }
+
+    while(levels > 0)
+    {
+        levels--;
+
+        for(ulong i = lasts[levels]; i > firsts[levels]; i--)
+            HeapifyDown(size, i - 1);
+    }
+}
+
+// I sottoalberi dei figli di un nodo sono heap indipendenti: si costruiscono come task separati,
+// poi la radice scende al suo posto
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::ParallelHeapify(ulong root, Executor &exec) noexcept
+{
+    ulong span = size;
+
+    for(ulong i = root; i > 0; i = Parent(i))
+        span /= Arity;
+
+    if(span < HeapGrain)
+    {
+        HeapifySubtree(root);
+        return;
+    }
+
+    Executor::TaskGroup group;
+    ulong child = FirstChild(root) + 1;
+    ulong end = std::min(FirstChild(root) + Arity, size);
+
+    try
+    {
+        for(; child < end; child++)
+            exec.Spawn(group, [this, child, &exec] { ParallelHeapify(child, exec); });
+    }
+    catch(...)
+    {
+        // Task non creato (memoria esaurita): i sottoalberi rimasti si costruiscono qui, in sequenza
+        for(; child < end; child++)
+            HeapifySubtree(child);
+    }
+
+    ParallelHeapify(FirstChild(root), exec);
+    exec.Sync(group);
+
+    HeapifyDown(size, root);
 }
 
-template <typename Data>
-void HeapVec<Data>::HeapSort() noexcept
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::HeapSort() noexcept
 {
     if(size > 1)
     {
@@ -130,8 +293,9 @@ void HeapVec<Data>::HeapSort() noexcept
 
         for(ulong i = size - 1; i >= 1; i--)
             {
-                std::swap(Elements[0], Elements[i]);
-                HeapifyDown(i, 0);
+                Data value = std::move(Elements[i]);
+                Elements[i] = std::move(Elements[0]);
+                FloydDown(i, std::move(value));
             }
     }
 }
@@ -4,6 +4,10 @@
 
 /* ************************************************************************** */
 
+#include <functional>
+
+/* ************************************************************************** */
+
 #include "../heap.hpp"
 #include "../../vector/vector.hpp"
 
@@ -13,12 +17,18 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
+// Arity is the number of children of every node: with 4 or 8 the children of a node
+// share a cache line and the tree is half or a third as deep as the binary one.
+// Compare orders the elements: the root is an element that no other one follows
+// (a max-heap with std::less, a min-heap with std::greater).
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
 class HeapVec : virtual public Heap<Data>,
                 virtual protected SortableVector<Data>{
   // Must extend Heap<Data>,
   // Could extend SortableVector<Data>
 
+  static_assert(Arity >= 2, "A heap needs at least two children per node");
+
 private:
 
 
@@ -27,12 +37,19 @@ protected:
   using Container::size;
   using SortableVector<Data>::Elements;
 
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
 public:
 
   using SortableVector<Data>::Front;
   using SortableVector<Data>::Back;
   using SortableVector<Data>::operator[];
   using SortableVector<Data>::Clear;
+  using SortableVector<Data>::Exists;
+  using SortableVector<Data>::Find;
+  using SortableVector<Data>::Count;
+  using SortableVector<Data>::ParallelFold;
+  using SortableVector<Data>::ParallelExists;
 
   // Default constructor
   HeapVec() = default;
@@ -72,27 +89,50 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function
+
+  const Data & KthLargest(ulong) const; // Element of the given rank in heap order (descending with std::less), starting from 0 (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from Heap)
 
   bool IsHeap() const noexcept override; // Override Heap member
 
-  void Heapify() noexcept override; // Override Heap member
+  void Heapify() noexcept override; // Override Heap member (subtrees built in parallel on the default executor)
+
+  void Heapify(Executor &) noexcept; // (subtrees built in parallel on a given executor)
 
   /* ************************************************************************ */
 
   // Specific member function (inherited from SortableLinearContainer)
 
-  inline void Sort() noexcept override; // Override SortableLinearContainer member
+  inline void Sort() noexcept override; // Override SortableLinearContainer member (ascending according to Compare)
 
 protected:
  
-  void HeapifyDown(ulong, ulong) noexcept;
+  static constexpr ulong HeapGrain = 1UL << 14; // Minimum number of elements of a subtree built as a task
+
+  static inline constexpr ulong FirstChild(ulong index) noexcept { return Arity * index + 1; }
+  static inline constexpr ulong Parent(ulong index) noexcept { return (index - 1) / Arity; }
+  inline ulong Internal(ulong length) const noexcept { return (length + Arity - 2) / Arity; } // Number of nodes with children
+
+  void HeapifyDown(ulong, ulong) noexcept; // Sift down moving a hole: one move per level instead of a swap
+  void HeapifyUp(ulong, ulong = 0) noexcept; // Sift up moving a hole, not above the given ancestor
+  void FloydDown(ulong, Data &&) noexcept; // Fills the empty root with the value: descends to a leaf, then sifts up
+  void HeapifySubtree(ulong) noexcept;
+  void ParallelHeapify(ulong, Executor &) noexcept;
   void HeapSort() noexcept;
   
 };
 
 /* ************************************************************************** */
 
+template <typename Data, ulong Arity = 2>
+using MinHeapVec = HeapVec<Data, Arity, std::greater<Data>>;
+
+/* ************************************************************************** */
+
 }
 
 #include "heapvec.cpp"
@@ -0,0 +1,317 @@
+#include <bit>
+#include <stdexcept>
+
+#include "maphash.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------MapHash: Constructors/Destructors-------------------------- */
+
+// Copy constructor
+template <typename Key, typename Value>
+MapHash<Key, Value>::MapHash(const MapHash &map) : MapHash(map.capacity)
+{
+    // Stessa capacita', tranne che per una mappa spostata (capacita' 0, nessun bucket da copiare)
+    for(ulong i = 0; i < map.capacity; i++)
+        Table[i] = map.Table[i];
+
+    size = map.size;
+}
+
+// Move constructor (the moved map is left without a table: lookups find nothing, the first
+// insertion rebuilds the empty table of Clear)
+template <typename Key, typename Value>
+MapHash<Key, Value>::MapHash(MapHash &&map) noexcept
+{
+    std::swap(Table, map.Table);
+    std::swap(capacity, map.capacity);
+    std::swap(shift, map.shift);
+    std::swap(size, map.size);
+}
+
+// Destructor
+template <typename Key, typename Value>
+MapHash<Key, Value>::~MapHash()
+{
+    delete[] Table;
+}
+
+/* ---------------------------MapHash: Assignments-------------------------- */
+
+// Copy assignment
+template <typename Key, typename Value>
+MapHash<Key, Value> & MapHash<Key, Value>::operator=(const MapHash &map)
+{
+    MapHash<Key, Value> * tmp = new MapHash<Key, Value>(map);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Key, typename Value>
+MapHash<Key, Value> & MapHash<Key, Value>::operator=(MapHash &&map) noexcept
+{
+    std::swap(Table, map.Table);
+    std::swap(capacity, map.capacity);
+    std::swap(shift, map.shift);
+    std::swap(size, map.size);
+
+    return *this;
+}
+
+/* ---------------------------MapHash: Comparison Operators-------------------------- */
+
+template <typename Key, typename Value>
+bool MapHash<Key, Value>::operator==(const MapHash &map) const noexcept
+{
+    if(size != map.size)
+        return false;
+
+    for(ulong i = 0; i < capacity; i++)
+        if(Table[i].full)
+        {
+            ulong slot = map.Probe(Table[i].entry.key);
+
+            if(!map.Table[slot].full || map.Table[slot].entry.value != Table[i].entry.value)
+                return false;
+        }
+
+    return true;
+}
+
+template <typename Key, typename Value>
+inline bool MapHash<Key, Value>::operator!=(const MapHash &map) const noexcept
+{
+    return !((*this) == map);
+}
+
+/* ---------------------------MapHash: Specific member functions (inherited from MapContainer)------------------------- */
+
+template <typename Key, typename Value>
+bool MapHash<Key, Value>::Exists(const Key &key) const noexcept
+{
+    return capacity > 0 && Table[Probe(key)].full;
+}
+
+template <typename Key, typename Value>
+const Value & MapHash<Key, Value>::Find(const Key &key) const
+{
+    if(capacity == 0)
+        throw std::length_error("Key Not Found from MapHash");
+
+    ulong slot = Probe(key);
+
+    if(!Table[slot].full)
+        throw std::length_error("Key Not Found from MapHash");
+
+    return Table[slot].entry.value;
+}
+
+template <typename Key, typename Value>
+Value & MapHash<Key, Value>::Find(const Key &key)
+{
+    return const_cast<Value &>(static_cast<const MapHash<Key, Value> *>(this)->Find(key));
+}
+
+template <typename Key, typename Value>
+bool MapHash<Key, Value>::InsertOrAssign(const Key &key, const Value &value)
+{
+    if(capacity == 0)
+        Clear();
+
+    ulong slot = Probe(key);
+
+    if(Table[slot].full)
+    {
+        Table[slot].entry.value = value;
+        return false;
+    }
+
+    checkResize();
+
+    slot = Probe(key);
+    Table[slot].entry = Entry(key, value);
+    Table[slot].full = true;
+    size++;
+
+    return true;
+}
+
+template <typename Key, typename Value>
+bool MapHash<Key, Value>::InsertOrAssign(const Key &key, Value &&value)
+{
+    if(capacity == 0)
+        Clear();
+
+    ulong slot = Probe(key);
+
+    if(Table[slot].full)
+    {
+        Table[slot].entry.value = std::move(value);
+        return false;
+    }
+
+    checkResize();
+
+    slot = Probe(key);
+    Table[slot].entry = Entry(key, std::move(value));
+    Table[slot].full = true;
+    size++;
+
+    return true;
+}
+
+template <typename Key, typename Value>
+Value & MapHash<Key, Value>::operator[](const Key &key)
+{
+    if(capacity == 0)
+        Clear();
+
+    ulong slot = Probe(key);
+
+    if(!Table[slot].full)
+    {
+        checkResize();
+
+        slot = Probe(key);
+        Table[slot].entry = Entry(key, Value {});
+        Table[slot].full = true;
+        size++;
+    }
+
+    return Table[slot].entry.value;
+}
+
+template <typename Key, typename Value>
+bool MapHash<Key, Value>::Remove(const Key &key)
+{
+    if(capacity == 0)
+        return false;
+
+    ulong hole = Probe(key);
+
+    if(!Table[hole].full)
+        return false;
+
+    // Backward shift: gli elementi successivi della stessa sequenza di probing
+    // vengono spostati indietro, cosi' non servono tombstone
+    ulong mask = capacity - 1;
+    ulong next = hole;
+
+    while(Table[next = (next + 1) & mask].full)
+    {
+        ulong home = HashKey(Table[next].entry.key);
+
+        if(((next - home) & mask) >= ((next - hole) & mask))
+        {
+            Table[hole].entry = std::move(Table[next].entry);
+            hole = next;
+        }
+    }
+
+    Table[hole].entry = Entry();
+    Table[hole].full = false;
+    size--;
+
+    checkResize();
+
+    return true;
+}
+
+template <typename Key, typename Value>
+void MapHash<Key, Value>::Traverse(TraverseFun fun) const
+{
+    for(ulong i = 0; i < capacity; i++)
+        if(Table[i].full)
+            fun(Table[i].entry.key, Table[i].entry.value);
+}
+
+template <typename Key, typename Value>
+void MapHash<Key, Value>::Map(MapFun fun)
+{
+    for(ulong i = 0; i < capacity; i++)
+        if(Table[i].full)
+            fun(Table[i].entry.key, Table[i].entry.value);
+}
+
+/* ---------------------------MapHash: Specific member functions (inherited from ClearableContainer)------------------------- */
+
+template <typename Key, typename Value>
+void MapHash<Key, Value>::Clear()
+{
+    delete[] Table;
+    Table = new Bucket[8] {};
+    capacity = 8;
+    shift = 64 - 3;
+    size = 0;
+}
+
+/* ---------------------------MapHash: Auxilary functions------------------------- */
+
+template <typename Key, typename Value>
+MapHash<Key, Value>::MapHash(ulong newCapacity)
+{
+    capacity = std::bit_ceil(std::max(newCapacity, 8UL));
+    shift = 64 - std::countr_zero(capacity);
+    Table = new Bucket[capacity] {};
+    size = 0;
+}
+
+// Hash moltiplicativo (Fibonacci): i bit alti del prodotto indicizzano la tabella
+template <typename Key, typename Value>
+inline ulong MapHash<Key, Value>::HashKey(const Key &key) const noexcept
+{
+    return (static_cast<ulong>(std::hash<Key>{}(key)) * 0x9E3779B97F4A7C15UL) >> shift;
+}
+
+template <typename Key, typename Value>
+ulong MapHash<Key, Value>::Probe(const Key &key) const noexcept
+{
+    ulong mask = capacity - 1;
+    ulong slot = HashKey(key);
+
+    while(Table[slot].full && Table[slot].entry.key != key)
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+template <typename Key, typename Value>
+void MapHash<Key, Value>::checkResize()
+{
+    if(4 * (size + 1) > 3 * capacity)
+        Resize(std::max(capacity * 2, 8UL));
+    else if(8 * size <= capacity && capacity > 8)
+        Resize(capacity / 2);
+}
+
+template <typename Key, typename Value>
+void MapHash<Key, Value>::Resize(ulong newCapacity)
+{
+    Bucket * oldTable = Table;
+    ulong oldCapacity = capacity;
+
+    capacity = newCapacity;
+    shift = 64 - std::countr_zero(capacity);
+    Table = new Bucket[capacity] {};
+
+    for(ulong i = 0; i < oldCapacity; i++)
+        if(oldTable[i].full)
+        {
+            ulong slot = Probe(oldTable[i].entry.key);
+
+            Table[slot].entry = std::move(oldTable[i].entry);
+            Table[slot].full = true;
+        }
+
+    delete[] oldTable;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,123 @@
+
+#ifndef MAPHASH_HPP
+#define MAPHASH_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../map.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Key, typename Value>
+class MapHash : virtual public MapContainer<Key, Value>{
+  // Must extend MapContainer<Key, Value>
+
+private:
+
+  // ...
+
+protected:
+
+  using Entry = KeyValue<Key, Value>;
+
+  struct Bucket {
+
+    // Data
+    Entry entry;
+    bool full = false;
+
+  };
+
+  using Container::size;
+
+  Bucket * Table = nullptr; // Open addressing with linear probing (a single contiguous table)
+  ulong capacity = 0; // Always a power of two
+  ulong shift = 0; // 64 - log2(capacity)
+
+public:
+
+  // Default constructor
+  MapHash() : MapHash(8) {}
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  MapHash(const MapHash &);
+
+  // Move constructor
+  MapHash(MapHash &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~MapHash();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  MapHash & operator=(const MapHash &);
+
+  // Move assignment
+  MapHash & operator=(MapHash &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const MapHash &) const noexcept;
+  inline bool operator!=(const MapHash &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MapContainer)
+
+  bool Exists(const Key &) const noexcept override; // Override MapContainer member
+
+  const Value & Find(const Key &) const override; // Override MapContainer member (must throw std::length_error when not found)
+  Value & Find(const Key &) override; // Override MapContainer member (must throw std::length_error when not found)
+
+  bool InsertOrAssign(const Key &, const Value &) override; // Override MapContainer member (copy of the value)
+  bool InsertOrAssign(const Key &, Value &&) override; // Override MapContainer member (move of the value)
+
+  Value & operator[](const Key &) override; // Override MapContainer member
+
+  bool Remove(const Key &) override; // Override MapContainer member
+
+  using typename MapContainer<Key, Value>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Override MapContainer member (no particular order)
+
+  using typename MapContainer<Key, Value>::MapFun;
+  void Map(MapFun) override; // Override MapContainer member (no particular order)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  MapHash(ulong);
+
+  inline ulong HashKey(const Key &) const noexcept;
+  ulong Probe(const Key &) const noexcept; // Slot of the key, or the empty slot ending its probe sequence
+
+  void checkResize();
+  void Resize(ulong);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "maphash.cpp"
+
+#endif
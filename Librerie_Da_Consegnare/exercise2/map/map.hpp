@@ -0,0 +1,148 @@
+
+#ifndef MAP_HPP
+#define MAP_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Key, typename Value>
+struct KeyValue {
+
+  // Data
+  Key key {};
+  Value value {};
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  KeyValue() = default;
+
+  // Specific constructors
+  KeyValue(const Key & k, const Value & v) : key(k), value(v) {}
+  KeyValue(const Key & k, Value && v) : key(k), value(std::move(v)) {}
+
+  /* ************************************************************************ */
+
+  // Comparison operators (the entries are ordered by key only)
+  inline bool operator==(const KeyValue & kv) const noexcept { return key == kv.key; }
+  inline bool operator!=(const KeyValue & kv) const noexcept { return !(key == kv.key); }
+  inline bool operator<(const KeyValue & kv) const noexcept { return key < kv.key; }
+  inline bool operator>(const KeyValue & kv) const noexcept { return key > kv.key; }
+
+};
+
+/* ************************************************************************** */
+
+template <typename Key, typename Value>
+class MapContainer : virtual public ClearableContainer{
+  // Must extend ClearableContainer
+
+private:
+
+  // ...
+
+protected:
+
+  // ...
+
+public:
+
+  // Destructor
+  virtual ~MapContainer() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  MapContainer & operator=(const MapContainer &) = delete; // Copy assignment of abstract types is not possible.
+
+  // Move assignment
+  MapContainer & operator=(MapContainer &&) noexcept = delete; // Move assignment of abstract types is not possible.
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const MapContainer &) const noexcept = delete; // Comparison of abstract types is not possible.
+  bool operator!=(const MapContainer &) const noexcept = delete; // Comparison of abstract types is not possible.
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  virtual bool Exists(const Key &) const noexcept = 0; // (concrete function should not throw exceptions)
+
+  virtual const Value & Find(const Key &) const = 0; // (non-mutable version; concrete function must throw std::length_error when not found)
+  virtual Value & Find(const Key &) = 0; // (mutable version; concrete function must throw std::length_error when not found)
+
+  virtual bool InsertOrAssign(const Key &, const Value &) = 0; // Copy of the value; True if inserted, false if assigned
+  virtual bool InsertOrAssign(const Key &, Value &&) = 0; // Move of the value; True if inserted, false if assigned
+
+  virtual Value & operator[](const Key &) = 0; // (a default value is inserted when the key is not found)
+
+  virtual bool Remove(const Key &) = 0;
+
+  using TraverseFun = std::function<void(const Key &, const Value &)>;
+  virtual void Traverse(TraverseFun) const = 0;
+
+  using MapFun = std::function<void(const Key &, Value &)>;
+  virtual void Map(MapFun) = 0;
+
+};
+
+/* ************************************************************************** */
+
+template <typename Key, typename Value>
+class OrderedMapContainer : virtual public MapContainer<Key, Value>{
+  // Must extend MapContainer<Key, Value>
+
+private:
+
+  // ...
+
+protected:
+
+  // ...
+
+public:
+
+  // Destructor
+  virtual ~OrderedMapContainer() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  OrderedMapContainer & operator=(const OrderedMapContainer &) = delete; // Copy assignment of abstract types is not possible.
+
+  // Move assignment
+  OrderedMapContainer & operator=(OrderedMapContainer &&) noexcept = delete; // Move assignment of abstract types is not possible.
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const OrderedMapContainer &) const noexcept = delete; // Comparison of abstract types is not possible.
+  bool operator!=(const OrderedMapContainer &) const noexcept = delete; // Comparison of abstract types is not possible.
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  virtual const KeyValue<Key, Value> & Predecessor(const Key &) const = 0; // (concrete function must throw std::length_error when not found)
+  virtual const KeyValue<Key, Value> & Successor(const Key &) const = 0; // (concrete function must throw std::length_error when not found)
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#endif
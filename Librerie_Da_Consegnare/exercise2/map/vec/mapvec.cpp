@@ -0,0 +1,206 @@
+#include "mapvec.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------MapVec: Constructors/Destructors-------------------------- */
+
+// Copy constructor
+template <typename Key, typename Value>
+MapVec<Key, Value>::MapVec(const MapVec &map) : SetVec<Entry>::SetVec(map) {}
+
+// Move constructor
+template <typename Key, typename Value>
+MapVec<Key, Value>::MapVec(MapVec &&map) noexcept : SetVec<Entry>::SetVec(std::move(map)) {}
+
+/* ---------------------------MapVec: Assignments-------------------------- */
+
+// Copy assignment
+template <typename Key, typename Value>
+MapVec<Key, Value> & MapVec<Key, Value>::operator=(const MapVec &map)
+{
+    SetVec<Entry>::operator=(map);
+    return *this;
+}
+
+// Move assignment
+template <typename Key, typename Value>
+MapVec<Key, Value> & MapVec<Key, Value>::operator=(MapVec &&map) noexcept
+{
+    SetVec<Entry>::operator=(std::move(map));
+    return *this;
+}
+
+/* ---------------------------MapVec: Comparison Operators-------------------------- */
+
+template <typename Key, typename Value>
+bool MapVec<Key, Value>::operator==(const MapVec &map) const noexcept
+{
+    if(size != map.size)
+        return false;
+
+    for(ulong i = 0; i < size; i++)
+        if(At(i).key != map.At(i).key || At(i).value != map.At(i).value)
+            return false;
+
+    return true;
+}
+
+template <typename Key, typename Value>
+inline bool MapVec<Key, Value>::operator!=(const MapVec &map) const noexcept
+{
+    return !((*this) == map);
+}
+
+/* ---------------------------MapVec: Specific member functions (inherited from OrderedMapContainer)------------------------- */
+
+template <typename Key, typename Value>
+const typename MapVec<Key, Value>::Entry & MapVec<Key, Value>::Predecessor(const Key &key) const
+{
+    ulong index = KeyLowerBound(key);
+
+    if(index == 0)
+        throw std::length_error("Predecessor Not Found from MapVec");
+
+    return At(index - 1);
+}
+
+template <typename Key, typename Value>
+const typename MapVec<Key, Value>::Entry & MapVec<Key, Value>::Successor(const Key &key) const
+{
+    ulong index = KeyUpperBound(key);
+
+    if(index == size)
+        throw std::length_error("Successor Not Found from MapVec");
+
+    return At(index);
+}
+
+/* ---------------------------MapVec: Specific member functions (inherited from MapContainer)------------------------- */
+
+template <typename Key, typename Value>
+bool MapVec<Key, Value>::Exists(const Key &key) const noexcept
+{
+    ulong index = KeyLowerBound(key);
+
+    return (index != size && At(index).key == key);
+}
+
+template <typename Key, typename Value>
+const Value & MapVec<Key, Value>::Find(const Key &key) const
+{
+    ulong index = KeyLowerBound(key);
+
+    if(index == size || At(index).key != key)
+        throw std::length_error("Key Not Found from MapVec");
+
+    return At(index).value;
+}
+
+template <typename Key, typename Value>
+Value & MapVec<Key, Value>::Find(const Key &key)
+{
+    return const_cast<Value &>(static_cast<const MapVec<Key, Value> *>(this)->Find(key));
+}
+
+template <typename Key, typename Value>
+bool MapVec<Key, Value>::InsertOrAssign(const Key &key, const Value &value)
+{
+    ulong index = KeyLowerBound(key);
+
+    if(index != size && At(index).key == key)
+    {
+        At(index).value = value;
+        return false;
+    }
+
+    IndexedInsert(index, Entry(key, value));
+    return true;
+}
+
+template <typename Key, typename Value>
+bool MapVec<Key, Value>::InsertOrAssign(const Key &key, Value &&value)
+{
+    ulong index = KeyLowerBound(key);
+
+    if(index != size && At(index).key == key)
+    {
+        At(index).value = std::move(value);
+        return false;
+    }
+
+    IndexedInsert(index, Entry(key, std::move(value)));
+    return true;
+}
+
+template <typename Key, typename Value>
+Value & MapVec<Key, Value>::operator[](const Key &key)
+{
+    ulong index = KeyLowerBound(key);
+
+    if(index == size || At(index).key != key)
+        IndexedInsert(index, Entry(key, Value {}));
+
+    return At(index).value;
+}
+
+template <typename Key, typename Value>
+bool MapVec<Key, Value>::Remove(const Key &key)
+{
+    ulong index = KeyLowerBound(key);
+
+    if(index == size || At(index).key != key)
+        return false;
+
+    IndexedRemove(index);
+    return true;
+}
+
+template <typename Key, typename Value>
+void MapVec<Key, Value>::Traverse(TraverseFun fun) const
+{
+    for(ulong i = 0; i < size; i++)
+        fun(At(i).key, At(i).value);
+}
+
+template <typename Key, typename Value>
+void MapVec<Key, Value>::Map(MapFun fun)
+{
+    for(ulong i = 0; i < size; i++)
+        fun(At(i).key, At(i).value);
+}
+
+/* ---------------------------MapVec: Specific member functions (inherited from ClearableContainer)------------------------- */
+
+template <typename Key, typename Value>
+void MapVec<Key, Value>::Clear()
+{
+    SetVec<Entry>::Clear();
+}
+
+/* ---------------------------MapVec: Auxilary functions------------------------- */
+
+// Le ricerche confrontano solo le chiavi, senza costruire una Entry temporanea
+
+template <typename Key, typename Value>
+inline ulong MapVec<Key, Value>::KeyLowerBound(const Key &key) const noexcept
+{
+    return PartitionPoint([&key] (const Entry &curr) { return curr.key < key; });
+}
+
+template <typename Key, typename Value>
+inline ulong MapVec<Key, Value>::KeyUpperBound(const Key &key) const noexcept
+{
+    return PartitionPoint([&key] (const Entry &curr) { return !(curr.key > key); });
+}
+
+template <typename Key, typename Value>
+inline typename MapVec<Key, Value>::Entry & MapVec<Key, Value>::At(ulong offset) const noexcept
+{
+    return Elements[RingIndex(offset)];
+}
+
+/* ************************************************************************** */
+
+}
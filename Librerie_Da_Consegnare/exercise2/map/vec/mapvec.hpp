@@ -0,0 +1,119 @@
+
+#ifndef MAPVEC_HPP
+#define MAPVEC_HPP
+
+/* ************************************************************************** */
+
+#include "../map.hpp"
+#include "../../set/vec/setvec.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Key, typename Value>
+class MapVec : virtual public OrderedMapContainer<Key, Value>,
+               virtual protected SetVec<KeyValue<Key, Value>>{
+  // Must extend OrderedMapContainer<Key, Value>
+  // Could extend SetVec<KeyValue<Key, Value>> (same circular buffer, keys and values side by side)
+
+private:
+
+  // ...
+
+protected:
+
+  using Entry = KeyValue<Key, Value>;
+
+  using Container::size;
+  using SetVec<Entry>::Elements;
+  using SetVec<Entry>::IndexedInsert;
+  using SetVec<Entry>::IndexedRemove;
+  using SetVec<Entry>::RingIndex;
+  using SetVec<Entry>::PartitionPoint;
+
+public:
+
+  // Default constructor
+  MapVec() = default;
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  MapVec(const MapVec &);
+
+  // Move constructor
+  MapVec(MapVec &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~MapVec() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  MapVec & operator=(const MapVec &);
+
+  // Move assignment
+  MapVec & operator=(MapVec &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const MapVec &) const noexcept;
+  inline bool operator!=(const MapVec &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedMapContainer)
+
+  const Entry & Predecessor(const Key &) const override; // Override OrderedMapContainer member (must throw std::length_error when not found)
+  const Entry & Successor(const Key &) const override; // Override OrderedMapContainer member (must throw std::length_error when not found)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MapContainer)
+
+  bool Exists(const Key &) const noexcept override; // Override MapContainer member
+
+  const Value & Find(const Key &) const override; // Override MapContainer member (must throw std::length_error when not found)
+  Value & Find(const Key &) override; // Override MapContainer member (must throw std::length_error when not found)
+
+  bool InsertOrAssign(const Key &, const Value &) override; // Override MapContainer member (copy of the value)
+  bool InsertOrAssign(const Key &, Value &&) override; // Override MapContainer member (move of the value)
+
+  Value & operator[](const Key &) override; // Override MapContainer member
+
+  bool Remove(const Key &) override; // Override MapContainer member
+
+  using typename MapContainer<Key, Value>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Override MapContainer member (keys in ascending order)
+
+  using typename MapContainer<Key, Value>::MapFun;
+  void Map(MapFun) override; // Override MapContainer member (keys in ascending order)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  inline ulong KeyLowerBound(const Key &) const noexcept; // First position with key >= the given one
+  inline ulong KeyUpperBound(const Key &) const noexcept; // First position with key > the given one
+
+  inline Entry & At(ulong) const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "mapvec.cpp"
+
+#endif
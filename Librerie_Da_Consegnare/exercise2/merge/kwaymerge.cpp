@@ -0,0 +1,361 @@
+#include <algorithm>
+
+#include "kwaymerge.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------KWayMerge: Constructors/Destructors -------------------------- */
+
+// Copy constructor
+template <typename Data, typename Compare>
+KWayMerge<Data, Compare>::KWayMerge(const KWayMerge &merge)
+{
+    count = merge.count;
+    size = merge.size;
+
+    if(count > 0)
+    {
+        runs = new const LinearContainer<Data> * [count];
+        positions = new ulong[count];
+        heads = new const Data * [count];
+        ends = new const Data * [count];
+        tree = new ulong[count];
+
+        std::copy(merge.runs, merge.runs + count, runs);
+        std::copy(merge.positions, merge.positions + count, positions);
+        std::copy(merge.heads, merge.heads + count, heads);
+        std::copy(merge.ends, merge.ends + count, ends);
+        std::copy(merge.tree, merge.tree + count, tree);
+    }
+}
+
+// Move constructor
+template <typename Data, typename Compare>
+KWayMerge<Data, Compare>::KWayMerge(KWayMerge &&merge) noexcept
+{
+    std::swap(runs, merge.runs);
+    std::swap(positions, merge.positions);
+    std::swap(heads, merge.heads);
+    std::swap(ends, merge.ends);
+    std::swap(tree, merge.tree);
+    std::swap(count, merge.count);
+    std::swap(size, merge.size);
+}
+
+// Destructor
+template <typename Data, typename Compare>
+KWayMerge<Data, Compare>::~KWayMerge()
+{
+    delete[] runs;
+    delete[] positions;
+    delete[] heads;
+    delete[] ends;
+    delete[] tree;
+}
+
+/* ---------------------------KWayMerge: Assignments -------------------------- */
+
+// Copy assignment
+template <typename Data, typename Compare>
+KWayMerge<Data, Compare> & KWayMerge<Data, Compare>::operator=(const KWayMerge &merge)
+{
+    KWayMerge<Data, Compare> * tmp = new KWayMerge<Data, Compare>(merge);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, typename Compare>
+KWayMerge<Data, Compare> & KWayMerge<Data, Compare>::operator=(KWayMerge &&merge) noexcept
+{
+    std::swap(runs, merge.runs);
+    std::swap(positions, merge.positions);
+    std::swap(heads, merge.heads);
+    std::swap(ends, merge.ends);
+    std::swap(tree, merge.tree);
+    std::swap(count, merge.count);
+    std::swap(size, merge.size);
+
+    return *this;
+}
+
+/* ---------------------------KWayMerge: Specific member functions -------------------------- */
+
+// Il torneo si rigioca da capo: O(N) confronti, trascurabili rispetto alla fusione
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Add(const LinearContainer<Data> &run)
+{
+    const LinearContainer<Data> ** newRuns = new const LinearContainer<Data> * [count + 1];
+    ulong * newPositions = new ulong[count + 1];
+    const Data ** newHeads = new const Data * [count + 1];
+    const Data ** newEnds = new const Data * [count + 1];
+    ulong * newTree = new ulong[count + 1];
+
+    std::copy(runs, runs + count, newRuns);
+    std::copy(positions, positions + count, newPositions);
+    std::copy(heads, heads + count, newHeads);
+    std::copy(ends, ends + count, newEnds);
+
+    std::swap(runs, newRuns);
+    std::swap(positions, newPositions);
+    std::swap(heads, newHeads);
+    std::swap(ends, newEnds);
+    std::swap(tree, newTree);
+
+    delete[] newRuns;
+    delete[] newPositions;
+    delete[] newHeads;
+    delete[] newEnds;
+    delete[] newTree;
+
+    runs[count] = &run;
+    positions[count] = 0;
+    Locate(count);
+
+    count++;
+    size += run.Size();
+
+    Build();
+}
+
+template <typename Data, typename Compare>
+inline ulong KWayMerge<Data, Compare>::Runs() const noexcept
+{
+    return count;
+}
+
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Rewind()
+{
+    size = 0;
+
+    for(ulong i = 0; i < count; i++)
+    {
+        positions[i] = 0;
+        Locate(i);
+        size += runs[i]->Size();
+    }
+
+    Build();
+}
+
+template <typename Data, typename Compare>
+inline const Data & KWayMerge<Data, Compare>::Front() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: KWayMerge is empty");
+
+    return *heads[tree[0]];
+}
+
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::RemoveFromFront()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: KWayMerge is empty");
+
+    Advance();
+}
+
+template <typename Data, typename Compare>
+Data KWayMerge<Data, Compare>::FrontNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: KWayMerge is empty");
+
+    Data front = *heads[tree[0]];
+
+    Advance();
+
+    return front;
+}
+
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Drain(TraverseFun fun, bool unique)
+{
+    Emit(fun, unique);
+}
+
+template <typename Data, typename Compare>
+SortableVector<Data> KWayMerge<Data, Compare>::Merged(bool unique)
+{
+    SortableVector<Data> merged(size);
+
+    if(size == 0)
+        return merged;
+
+    Data * out = &merged[0];
+    Data * first = out;
+
+    Emit
+    (
+        [&out] (const Data &curr)
+        {
+            *out++ = curr;
+        },
+        unique
+    );
+
+    merged.Resize(out - first);
+
+    return merged;
+}
+
+// Il vettore e' gia' ordinato e senza duplicati: BulkBuild se ne accorge e non lo riordina
+template <typename Data, typename Compare>
+SetVec<Data, Compare> KWayMerge<Data, Compare>::MergedSet()
+{
+    SortableVector<Data> merged = Merged(true);
+
+    return SetVec<Data, Compare>(std::move(merged));
+}
+
+/* ---------------------------KWayMerge: Specific member function (inherited from ClearableContainer) -------------------------- */
+
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Clear()
+{
+    delete[] runs;
+    delete[] positions;
+    delete[] heads;
+    delete[] ends;
+    delete[] tree;
+
+    runs = nullptr;
+    positions = nullptr;
+    heads = nullptr;
+    ends = nullptr;
+    tree = nullptr;
+
+    count = 0;
+    size = 0;
+}
+
+/* ---------------------------KWayMerge: Auxilary functions -------------------------- */
+
+// Un vettore si scorre con un puntatore fino alla fine; le altre run elemento per elemento
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Locate(ulong run)
+{
+    const LinearContainer<Data> &cont = *runs[run];
+
+    heads[run] = (positions[run] < cont.Size()) ? &cont[positions[run]] : nullptr;
+    ends[run] = (heads[run] != nullptr && dynamic_cast<const Vector<Data> *>(&cont) != nullptr) ? heads[run] + (cont.Size() - positions[run]) : nullptr;
+}
+
+template <typename Data, typename Compare>
+inline void KWayMerge<Data, Compare>::Next(ulong run)
+{
+    positions[run]++;
+
+    if(ends[run] != nullptr)
+    {
+        if(++heads[run] == ends[run])
+            heads[run] = nullptr;
+    }
+    else
+        heads[run] = (positions[run] < runs[run]->Size()) ? &(*runs[run])[positions[run]] : nullptr;
+}
+
+template <typename Data, typename Compare>
+inline bool KWayMerge<Data, Compare>::Before(ulong fst, ulong snd) const
+{
+    if(heads[fst] == nullptr)
+        return false;
+    if(heads[snd] == nullptr)
+        return true;
+
+    if(compare(*heads[fst], *heads[snd]))
+        return true;
+    if(compare(*heads[snd], *heads[fst]))
+        return false;
+
+    return fst < snd;
+}
+
+// I nodi 1 .. count - 1 sono interni, le foglie count .. 2 count - 1: lo schema funziona
+// per qualsiasi count, non solo per le potenze di due
+template <typename Data, typename Compare>
+ulong KWayMerge<Data, Compare>::Play(ulong node)
+{
+    if(node >= count)
+        return node - count;
+
+    ulong left = Play(2 * node);
+    ulong right = Play(2 * node + 1);
+
+    if(Before(left, right))
+    {
+        tree[node] = right;
+        return left;
+    }
+
+    tree[node] = left;
+    return right;
+}
+
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Build()
+{
+    if(count > 0)
+        tree[0] = Play(1);
+}
+
+// Il vincitore avanza e risale verso la radice: in ogni nodo del suo cammino rigioca contro il
+// perdente salvato li', e chi perde resta nel nodo
+template <typename Data, typename Compare>
+void KWayMerge<Data, Compare>::Advance()
+{
+    ulong winner = tree[0];
+
+    Next(winner);
+    size--;
+
+    const Data * head = heads[winner];
+
+    for(ulong node = (winner + count) / 2; node > 0; node /= 2)
+    {
+        ulong loser = tree[node];
+        const Data * other = heads[loser];
+
+        // Vince il perdente salvato se la run del vincitore e' finita, se e' minore o, a parita', se
+        // viene da una run precedente
+        if(other != nullptr && (head == nullptr || compare(*other, *head) || (loser < winner && !compare(*head, *other))))
+        {
+            tree[node] = winner;
+            winner = loser;
+            head = other;
+        }
+    }
+
+    tree[0] = winner;
+}
+
+template <typename Data, typename Compare>
+template <typename Fun>
+void KWayMerge<Data, Compare>::Emit(Fun fun, bool unique)
+{
+    // Le run restano in memoria fino alla fine: l'ultimo elemento passato e' ancora valido
+    // e basta un confronto per riconoscere un duplicato
+    const Data * last = nullptr;
+
+    while(size > 0)
+    {
+        const Data * front = heads[tree[0]];
+
+        if(!unique || last == nullptr || compare(*last, *front))
+            fun(*front);
+
+        last = front;
+        Advance();
+    }
+}
+
+/* ************************************************************************** */
+
+}
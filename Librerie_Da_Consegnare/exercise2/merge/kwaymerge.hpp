@@ -0,0 +1,123 @@
+
+#ifndef KWAYMERGE_HPP
+#define KWAYMERGE_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+#include "../container/linear.hpp"
+#include "../vector/vector.hpp"
+#include "../set/vec/setvec.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Merge of N runs sorted according to Compare through a tournament (loser) tree: every internal
+// node keeps the run that lost the match played there, the root the overall winner. Taking the
+// smallest head replays only the matches on the path of its run, log N comparisons per element
+// and O(total log N) overall. Equal elements come out in the order of the runs (stable).
+// The runs are read in place and must outlive the merge and not change during it: a vector is
+// walked with a pointer, any other run with operator[] (constant time on SetVec, linear on List).
+// Size counts the elements left.
+
+template <typename Data, typename Compare = std::less<Data>>
+class KWayMerge : virtual public ClearableContainer {
+  // Must extend ClearableContainer
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  const LinearContainer<Data> ** runs = nullptr;
+  ulong * positions = nullptr; // Next element of every run
+  const Data ** heads = nullptr; // Address of that element (nullptr once the run is over)
+  const Data ** ends = nullptr; // One past the last element of a run stored contiguously, nullptr otherwise
+  ulong * tree = nullptr; // tree[0] winner, tree[1 .. count - 1] losers; leaf of run i at count + i
+  ulong count = 0;
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
+public:
+
+  // Default constructor
+  KWayMerge() = default;
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  KWayMerge(const KWayMerge &); // (same runs, same progress)
+
+  // Move constructor
+  KWayMerge(KWayMerge &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~KWayMerge();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  KWayMerge & operator=(const KWayMerge &);
+
+  // Move assignment
+  KWayMerge & operator=(KWayMerge &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  void Add(const LinearContainer<Data> &); // Adds a sorted run (from its first element)
+  inline ulong Runs() const noexcept;
+  void Rewind(); // Restarts every run from its first element
+
+  inline const Data & Front() const; // Next element of the merge (must throw std::length_error when empty)
+  void RemoveFromFront(); // (must throw std::length_error when empty)
+  Data FrontNRemove(); // (must throw std::length_error when empty)
+
+  using TraverseFun = std::function<void(const Data &)>;
+  void Drain(TraverseFun, bool = false); // Every element left, in order, to the function (optionally one per group of equivalent elements)
+
+  SortableVector<Data> Merged(bool = false); // Every element left in a vector (optionally without duplicates)
+  SetVec<Data, Compare> MergedSet(); // Every element left in a set
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member (drops the runs)
+
+protected:
+
+  // Auxiliary functions
+
+  void Locate(ulong); // Address of the current element of a run, and of its end for a vector
+  inline void Next(ulong); // Moves a run to its next element
+  inline bool Before(ulong, ulong) const; // Head of a run before the other's: exhausted runs last, ties by run index
+  ulong Play(ulong); // Plays the matches of a subtree, returns its winner
+  void Build();
+  void Advance(); // Moves the winner run to its next element and replays its path
+
+  template <typename Fun>
+  void Emit(Fun, bool); // The loop of Drain, without the indirect call
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "kwaymerge.cpp"
+
+#endif
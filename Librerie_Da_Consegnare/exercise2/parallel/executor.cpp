@@ -0,0 +1,260 @@
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "executor.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Classe non template: le funzioni sono inline perche' il file e' incluso dall'header
+
+/* ---------------------------Executor: Constructors/Destructors-------------------------- */
+
+// Default constructor
+inline Executor::Executor() : Executor(std::max(std::thread::hardware_concurrency(), 1U) - 1) {}
+
+// Specific constructor
+inline Executor::Executor(ulong newWorkers, bool pin)
+{
+    workers = newWorkers;
+    Queues = new Queue[workers + 1];
+    Workers = new std::thread[workers];
+
+    for(ulong i = 0; i < workers; i++)
+    {
+        Workers[i] = std::thread(&Executor::Work, this, i);
+
+#if defined(__linux__)
+        if(pin)
+        {
+            // Il thread chiamante resta libero; il worker i va sul core i + 1
+            cpu_set_t cores;
+            CPU_ZERO(&cores);
+            CPU_SET((i + 1) % std::max(std::thread::hardware_concurrency(), 1U), &cores);
+            pthread_setaffinity_np(Workers[i].native_handle(), sizeof(cpu_set_t), &cores);
+        }
+#else
+        (void) pin;
+#endif
+    }
+}
+
+// Destructor
+inline Executor::~Executor()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+
+    wakeup.notify_all();
+
+    for(ulong i = 0; i < workers; i++)
+        Workers[i].join();
+
+    delete[] Workers;
+    delete[] Queues;
+}
+
+/* ---------------------------Executor: Specific member functions-------------------------- */
+
+inline ulong Executor::Threads() const noexcept
+{
+    return workers + 1;
+}
+
+inline void Executor::Spawn(TaskGroup &group, std::function<void()> fun)
+{
+    group.owner = this;
+    group.pending.fetch_add(1, std::memory_order_relaxed);
+
+    Queue &queue = Queues[OwnQueue()];
+
+    try
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(Task {std::move(fun), &group});
+    }
+    catch(...)
+    {
+        // Il task non e' in coda: il gruppo non deve aspettarlo
+        group.pending.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+
+    // queued e sleeping sono sequenzialmente consistenti: o il worker che si addormenta vede
+    // il nuovo task, o questa notifica arriva dopo che e' entrato in attesa
+    queued.fetch_add(1);
+
+    if(sleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        wakeup.notify_one();
+    }
+}
+
+inline void Executor::Sync(TaskGroup &group)
+{
+    Wait(group);
+
+    if(group.error)
+    {
+        std::exception_ptr error = group.error;
+        group.error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+inline void Executor::ParallelFor(ulong count, const TaskFun &fun)
+{
+    if(count == 0)
+        return;
+
+    if(workers == 0 || count == 1)
+    {
+        for(ulong i = 0; i < count; i++)
+            fun(i);
+        return;
+    }
+
+    TaskGroup group;
+
+    for(ulong i = 1; i < count; i++)
+        Spawn(group, [&fun, i] { fun(i); });
+
+    // Il primo indice gira sul chiamante; gli altri task devono finire prima di uscire anche in caso di errore
+    std::exception_ptr error;
+
+    try
+    {
+        fun(0);
+    }
+    catch(...)
+    {
+        error = std::current_exception();
+    }
+
+    Sync(group);
+
+    if(error)
+        std::rethrow_exception(error);
+}
+
+inline Executor & Executor::Default()
+{
+    const char * threads = std::getenv("LASD_THREADS");
+
+    static Executor executor((threads != nullptr)
+                             ? std::max(std::strtoul(threads, nullptr, 10), 1UL) - 1
+                             : std::max(std::thread::hardware_concurrency(), 1U) - 1);
+    return executor;
+}
+
+/* ---------------------------Executor: Auxiliary functions-------------------------- */
+
+// Nel frattempo si eseguono altri task: anche quelli del gruppo, se nessun worker li ha presi
+inline void Executor::Wait(TaskGroup &group) noexcept
+{
+    while(group.pending.load(std::memory_order_acquire) > 0)
+        if(!RunOne())
+            std::this_thread::yield();
+}
+
+/* ---------------------------Executor::TaskGroup: Destructor-------------------------- */
+
+inline Executor::TaskGroup::~TaskGroup()
+{
+    if(owner != nullptr)
+        owner->Wait(*this);
+}
+
+inline void Executor::Work(ulong index)
+{
+    current = this;
+    self = index;
+
+    while(true)
+    {
+        if(RunOne())
+            continue;
+
+        std::unique_lock<std::mutex> guard(lock);
+
+        if(stop)
+            return;
+
+        sleeping.fetch_add(1);
+
+        if(queued.load() == 0)
+            wakeup.wait(guard);
+
+        sleeping.fetch_sub(1);
+    }
+}
+
+inline bool Executor::RunOne()
+{
+    ulong own = OwnQueue();
+    Task task;
+    bool found = false;
+
+    // Prima la propria coda dal fondo (LIFO), poi il furto dalla testa delle altre (FIFO)
+    {
+        std::lock_guard<std::mutex> guard(Queues[own].lock);
+
+        if(!Queues[own].tasks.empty())
+        {
+            task = std::move(Queues[own].tasks.back());
+            Queues[own].tasks.pop_back();
+            found = true;
+        }
+    }
+
+    for(ulong k = 1; !found && k <= workers; k++)
+    {
+        Queue &victim = Queues[(own + k) % (workers + 1)];
+        std::lock_guard<std::mutex> guard(victim.lock);
+
+        if(!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if(!found)
+        return false;
+
+    queued.fetch_sub(1);
+
+    try
+    {
+        task.fun();
+    }
+    catch(...)
+    {
+        std::lock_guard<std::mutex> guard(task.group->lock);
+
+        if(!task.group->error)
+            task.group->error = std::current_exception();
+    }
+
+    // Dopo il decremento il gruppo puo' essere gia' distrutto da Sync: non va piu' toccato
+    task.group->pending.fetch_sub(1, std::memory_order_release);
+
+    return true;
+}
+
+inline ulong Executor::OwnQueue() const noexcept
+{
+    return (current == this) ? self : workers;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,156 @@
+
+#ifndef EXECUTOR_HPP
+#define EXECUTOR_HPP
+
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Work-stealing scheduler shared by the parallel algorithms of the containers.
+// Every worker owns a deque: it pushes and pops its own tasks at the back (the most recent,
+// still in cache) while idle workers steal from the front (the oldest, usually the biggest).
+// Threads outside the executor share one more deque. A thread waiting in Sync keeps running
+// tasks instead of blocking, so fork/join recursion never stalls.
+
+class Executor {
+
+private:
+
+  // ...
+
+public:
+
+  // Tasks spawned together and waited for by Sync. The destructor waits too, so a group left by
+  // an exception never outlives its tasks (their exceptions are then dropped)
+  class TaskGroup {
+
+    friend class Executor;
+
+  protected:
+
+    std::atomic<ulong> pending = 0;
+    std::mutex lock;
+    std::exception_ptr error;
+    Executor * owner = nullptr; // Executor of the spawned tasks
+
+  public:
+
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup & operator=(const TaskGroup &) = delete;
+
+    inline ~TaskGroup();
+
+  };
+
+protected:
+
+  struct Task {
+
+    // Data
+    std::function<void()> fun;
+    TaskGroup * group = nullptr;
+
+  };
+
+  struct Queue {
+
+    // Data
+    std::mutex lock;
+    std::deque<Task> tasks;
+
+  };
+
+  std::thread * Workers = nullptr;
+  Queue * Queues = nullptr; // One per worker, plus the one shared by the other threads
+  ulong workers = 0;
+
+  std::atomic<ulong> queued = 0;
+  std::atomic<ulong> sleeping = 0;
+  std::mutex lock;
+  std::condition_variable wakeup;
+  bool stop = false;
+
+  static inline thread_local const Executor * current = nullptr; // Executor of the running worker
+  static inline thread_local ulong self = 0; // Index of the running worker
+
+public:
+
+  // Default constructor
+  Executor(); // One worker for every hardware thread except the caller's
+
+  /* ************************************************************************ */
+
+  // Specific constructor
+  explicit Executor(ulong, bool = false); // A given number of worker threads, optionally pinned to distinct cores
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  Executor(const Executor &) = delete;
+
+  // Move constructor
+  Executor(Executor &&) = delete;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~Executor();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  Executor & operator=(const Executor &) = delete;
+
+  // Move assignment
+  Executor & operator=(Executor &&) = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline ulong Threads() const noexcept; // Workers plus the calling thread
+
+  void Spawn(TaskGroup &, std::function<void()>); // (the task may run on any thread, or on the caller in Sync)
+  void Sync(TaskGroup &); // Returns when every task of the group is over (rethrows the first exception)
+
+  using TaskFun = std::function<void(ulong)>;
+  void ParallelFor(ulong, const TaskFun &); // Runs the function on 0, ..., n-1 and returns when all calls are over (rethrows the first exception)
+
+  static Executor & Default(); // Executor shared by the whole program (LASD_THREADS sets its number of threads)
+
+protected:
+
+  // Auxiliary functions
+
+  void Work(ulong);
+  bool RunOne(); // Runs a task of the own deque or a stolen one, if any
+  void Wait(TaskGroup &) noexcept; // Runs tasks until every task of the group is over
+  inline ulong OwnQueue() const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "executor.cpp"
+
+#endif
@@ -0,0 +1,175 @@
+#include <bit>
+#include <type_traits>
+#include <utility>
+
+#include "parallelsort.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------ParallelSort: Auxiliary functions-------------------------- */
+
+template <typename Data, typename Compare>
+void SortInsertion(Data * elements, ulong length, Compare comp)
+{
+    for(ulong i = 1; i < length; i++)
+    {
+        Data key = std::move(elements[i]);
+        ulong j = i;
+
+        while(j > 0 && comp(key, elements[j - 1]))
+        {
+            elements[j] = std::move(elements[j - 1]);
+            j--;
+        }
+
+        elements[j] = std::move(key);
+    }
+}
+
+template <typename Data, typename Compare>
+void SortHeapDown(Data * elements, ulong length, ulong root, Compare comp)
+{
+    ulong child;
+
+    while((child = 2 * root + 1) < length)
+    {
+        if(child + 1 < length && comp(elements[child], elements[child + 1]))
+            child++;
+
+        if(!comp(elements[root], elements[child]))
+            return;
+
+        std::swap(elements[root], elements[child]);
+        root = child;
+    }
+}
+
+template <typename Data, typename Compare>
+void SortHeap(Data * elements, ulong length, Compare comp)
+{
+    for(ulong i = length / 2; i > 0; i--)
+        SortHeapDown(elements, length, i - 1, comp);
+
+    for(ulong i = length - 1; i > 0; i--)
+    {
+        std::swap(elements[0], elements[i]);
+        SortHeapDown(elements, i, 0, comp);
+    }
+}
+
+// Partizione di Hoare attorno alla mediana di tre: il pivot resta nell'array per tutta la partizione
+// e alla fine va al suo posto. Restituisce la sua posizione
+template <typename Data, typename Compare>
+ulong SortPartition(Data * elements, ulong length, Compare comp)
+{
+    ulong mid = length / 2;
+
+    if(comp(elements[mid], elements[0]))
+        std::swap(elements[mid], elements[0]);
+    if(comp(elements[length - 1], elements[mid]))
+    {
+        std::swap(elements[length - 1], elements[mid]);
+        if(comp(elements[mid], elements[0]))
+            std::swap(elements[mid], elements[0]);
+    }
+
+    // Il pivot va in length - 2: elements[0] (non maggiore) e il pivot stesso fanno da sentinelle
+    ulong last = length - 2;
+    std::swap(elements[mid], elements[last]);
+
+    // Se la copia non puo' lanciare si confronta con una copia locale, che il compilatore tiene nei
+    // registri; altrimenti con il riferimento all'elemento, che resta fermo fino alla fine
+    using Pivot = std::conditional_t<std::is_nothrow_copy_constructible_v<Data>, const Data, const Data &>;
+    Pivot pivot = elements[last];
+    ulong i = 0, j = last;
+
+    while(true)
+    {
+        while(comp(elements[++i], pivot));
+        while(comp(pivot, elements[--j]));
+
+        if(i >= j)
+            break;
+
+        std::swap(elements[i], elements[j]);
+    }
+
+    std::swap(elements[i], elements[last]);
+
+    return i;
+}
+
+template <typename Data, typename Compare>
+void SortRange(Data * elements, ulong length, ulong depth, Executor &exec, Compare comp)
+{
+    while(length > 16)
+    {
+        if(depth == 0)
+        {
+            SortHeap(elements, length, comp);
+            return;
+        }
+
+        depth--;
+
+        ulong left = SortPartition(elements, length, comp);
+        ulong right = left + 1; // Il pivot e' gia' al suo posto
+
+        if(length >= SortGrain && exec.Threads() > 1)
+        {
+            // Fork: la parte sinistra diventa un task, la destra resta su questo thread. Se il task
+            // non si puo' creare (memoria esaurita) si prosegue in sequenza; se la destra lancia,
+            // il distruttore di group aspetta la sinistra prima che lo stack venga liberato
+            Executor::TaskGroup group;
+            bool forked = false;
+
+            try
+            {
+                exec.Spawn(group, [elements, left, depth, &exec, comp] { SortRange(elements, left, depth, exec, comp); });
+                forked = true;
+            }
+            catch(...)
+            {
+                // Nessun task in volo: le due parti si ordinano qui sotto
+            }
+
+            if(forked)
+            {
+                SortRange(elements + right, length - right, depth, exec, comp);
+                exec.Sync(group);
+
+                return;
+            }
+        }
+
+        // Ricorsione sulla parte piu' piccola, ciclo sulla piu' grande: stack O(log n)
+        if(left < length - right)
+        {
+            SortRange(elements, left, depth, exec, comp);
+            elements += right;
+            length -= right;
+        }
+        else
+        {
+            SortRange(elements + right, length - right, depth, exec, comp);
+            length = left;
+        }
+    }
+
+    SortInsertion(elements, length, comp);
+}
+
+/* ---------------------------ParallelSort-------------------------- */
+
+template <typename Data, typename Compare>
+void ParallelSort(Data * elements, ulong length, Executor &exec, Compare comp)
+{
+    if(length > 1)
+        SortRange(elements, length, 2 * std::bit_width(length), exec, comp);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,37 @@
+
+#ifndef PARALLELSORT_HPP
+#define PARALLELSORT_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "executor.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Fork/join quicksort on a contiguous array: the two sides of every partition above
+// SortGrain elements are sorted as separate tasks. Median of three pivots, insertion sort
+// on short ranges and a heapsort fallback when the recursion gets too deep (O(n log n) worst case).
+// A part whose task cannot be spawned (out of memory) is sorted on the calling thread instead, so
+// only the comparator or the moves can make it throw.
+// Not stable. The order is the one of the comparator (operator< by default).
+
+inline constexpr ulong SortGrain = 1UL << 13; // Minimum number of elements for a task
+
+template <typename Data, typename Compare = std::less<Data>>
+void ParallelSort(Data *, ulong, Executor & = Executor::Default(), Compare = Compare());
+
+/* ************************************************************************** */
+
+}
+
+#include "parallelsort.cpp"
+
+#endif
@@ -13,11 +13,15 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
+// The tip is the greatest element according to Compare (the smallest one in MinPQHeap).
+// Cancel removes an element lazily: the value goes into a heap of tombstones and the element
+// leaves the queue when it reaches the tip, or at the next compaction (once the tombstones
+// exceed a quarter of the elements). Until then it still counts in Size and in the positions.
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
 class PQHeap : virtual public PQ<Data>,
-               virtual protected HeapVec<Data> {
+               virtual protected HeapVec<Data, Arity, Compare> {
   // Must extend PQ<Data>,
-  // Could extend HeapVec<Data>
+  // Could extend HeapVec<Data, Arity>
 
 private:
 
@@ -25,17 +29,32 @@ private:
 protected:
 
   using Container::size;
-  using HeapVec<Data>::Elements;
-  using HeapVec<Data>::Heapify;
-  using HeapVec<Data>::HeapifyDown;  
+  using HeapVec<Data, Arity, Compare>::Elements;
+  using HeapVec<Data, Arity, Compare>::Heapify;
+  using HeapVec<Data, Arity, Compare>::HeapifyDown;
+  using HeapVec<Data, Arity, Compare>::HeapifyUp;
+  using HeapVec<Data, Arity, Compare>::FloydDown;
+  using HeapVec<Data, Arity, Compare>::HeapSort;
+  using HeapVec<Data, Arity, Compare>::Parent;
+  using HeapVec<Data, Arity, Compare>::compare;
   
   ulong capacity = 0;
+
+  static constexpr ulong CompactDivisor = 4; // Compaction once the tombstones exceed 1/CompactDivisor of the elements
+
+  PQHeap * tombstones = nullptr; // Values cancelled but still in the heap (allocated by the first Cancel)
   
 public:
 
-  using HeapVec<Data>::Front;
-  using HeapVec<Data>::Back;
-  using HeapVec<Data>::operator[];
+  using HeapVec<Data, Arity, Compare>::Front;
+  using HeapVec<Data, Arity, Compare>::Back;
+  using HeapVec<Data, Arity, Compare>::operator[];
+  using HeapVec<Data, Arity, Compare>::KthLargest;
+  using HeapVec<Data, Arity, Compare>::Exists;
+  using HeapVec<Data, Arity, Compare>::Find;
+  using HeapVec<Data, Arity, Compare>::Count;
+  using HeapVec<Data, Arity, Compare>::ParallelFold;
+  using HeapVec<Data, Arity, Compare>::ParallelExists;
   
   // Default constructor
   PQHeap();
@@ -58,7 +77,7 @@ public:
   /* ************************************************************************ */
 
   // Destructor
-  virtual ~PQHeap() = default;
+  virtual ~PQHeap();
 
   /* ************************************************************************ */
 
@@ -70,6 +89,20 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions
+
+  void InsertAll(const TraversableContainer<Data> &); // Inserts every element of the container (Copy of the values)
+  void InsertAll(MappableContainer<Data> &&); // Inserts every element of the container (Move of the values)
+
+  void Meld(PQHeap &&); // Moves every element of the given queue here, leaving it empty
+
+  void Remove(ulong); // Removes the element in the given position (must throw std::out_of_range when out of range)
+
+  void Cancel(const Data &); // Lazy removal of an element equivalent to the value (which must be in the queue)
+  inline ulong Cancelled() const noexcept; // Cancelled elements still in the queue
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from PQ)
 
   inline const Data & Tip() const override; // Override PQ member (must throw std::length_error when empty)
@@ -86,14 +119,25 @@ public:
   
 protected:
 
-  void HeapifyUp(ulong) noexcept;
   void checkResize();
   void Resize(const ulong) override;
 
+  void Pop(); // RemoveTip without the check and the purge of the tombstones
+  void Purge(); // Drops the cancelled elements from the tip
+  void Compact(); // Drops every cancelled element and rebuilds the heap
+
+  void Reserve(ulong); // Room for the given number of elements with a single reallocation
+  void HeapifyAppended(ulong); // Restores the heap after appending elements from the given position
+
 };
 
 /* ************************************************************************** */
 
+template <typename Data, ulong Arity = 2>
+using MinPQHeap = PQHeap<Data, Arity, std::greater<Data>>;
+
+/* ************************************************************************** */
+
 }
 
 #include "pqheap.cpp"
@@ -0,0 +1,371 @@
+#include <algorithm>
+
+#include "indexedpqheap.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------IndexedPQHeap: Constructors/Destructors-------------------------- */
+
+// Copy constructor
+template <typename Data, ulong Arity, typename Compare>
+IndexedPQHeap<Data, Arity, Compare>::IndexedPQHeap(const IndexedPQHeap &pq)
+{
+    capacity = pq.capacity;
+    Elements = new Data[capacity] {};
+    Handles = new Handle[capacity];
+    Positions = new ulong[capacity];
+    Free = new Handle[capacity];
+
+    std::copy(pq.Elements, pq.Elements + pq.size, Elements);
+    std::copy(pq.Handles, pq.Handles + pq.size, Handles);
+    std::copy(pq.Positions, pq.Positions + pq.handles, Positions);
+    std::copy(pq.Free, pq.Free + pq.free, Free);
+
+    size = pq.size;
+    handles = pq.handles;
+    free = pq.free;
+}
+
+// Move constructor
+template <typename Data, ulong Arity, typename Compare>
+IndexedPQHeap<Data, Arity, Compare>::IndexedPQHeap(IndexedPQHeap &&pq) noexcept
+{
+    std::swap(Elements, pq.Elements);
+    std::swap(Handles, pq.Handles);
+    std::swap(Positions, pq.Positions);
+    std::swap(Free, pq.Free);
+    std::swap(size, pq.size);
+    std::swap(handles, pq.handles);
+    std::swap(free, pq.free);
+    std::swap(capacity, pq.capacity);
+}
+
+// Destructor
+template <typename Data, ulong Arity, typename Compare>
+IndexedPQHeap<Data, Arity, Compare>::~IndexedPQHeap()
+{
+    delete[] Elements;
+    delete[] Handles;
+    delete[] Positions;
+    delete[] Free;
+}
+
+/* ---------------------------IndexedPQHeap: Assignments-------------------------- */
+
+// Copy assignment
+template <typename Data, ulong Arity, typename Compare>
+IndexedPQHeap<Data, Arity, Compare> & IndexedPQHeap<Data, Arity, Compare>::operator=(const IndexedPQHeap &pq)
+{
+    IndexedPQHeap<Data, Arity, Compare> * tmp = new IndexedPQHeap<Data, Arity, Compare>(pq);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, ulong Arity, typename Compare>
+IndexedPQHeap<Data, Arity, Compare> & IndexedPQHeap<Data, Arity, Compare>::operator=(IndexedPQHeap &&pq) noexcept
+{
+    std::swap(Elements, pq.Elements);
+    std::swap(Handles, pq.Handles);
+    std::swap(Positions, pq.Positions);
+    std::swap(Free, pq.Free);
+    std::swap(size, pq.size);
+    std::swap(handles, pq.handles);
+    std::swap(free, pq.free);
+    std::swap(capacity, pq.capacity);
+
+    return *this;
+}
+
+/* ---------------------------IndexedPQHeap: Comparison Operators-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+bool IndexedPQHeap<Data, Arity, Compare>::operator==(const IndexedPQHeap &pq) const noexcept
+{
+    if(size != pq.size)
+        return false;
+
+    for(ulong i = 0; i < size; i++)
+        if(!pq.Contains(Handles[i]) || pq.Elements[pq.Positions[Handles[i]]] != Elements[i])
+            return false;
+
+    return true;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool IndexedPQHeap<Data, Arity, Compare>::operator!=(const IndexedPQHeap &pq) const noexcept
+{
+    return !((*this) == pq);
+}
+
+/* ---------------------------IndexedPQHeap: Specific member functions-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+inline const Data & IndexedPQHeap<Data, Arity, Compare>::Tip() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: IndexedPQHeap is empty");
+
+    return Elements[0];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline typename IndexedPQHeap<Data, Arity, Compare>::Handle IndexedPQHeap<Data, Arity, Compare>::TipHandle() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: IndexedPQHeap is empty");
+
+    return Handles[0];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::RemoveTip()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: IndexedPQHeap is empty");
+
+    RemoveAt(0);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+Data IndexedPQHeap<Data, Arity, Compare>::TipNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: IndexedPQHeap is empty");
+
+    Data tip = std::move(Elements[0]);
+    RemoveAt(0);
+
+    return tip;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+typename IndexedPQHeap<Data, Arity, Compare>::Handle IndexedPQHeap<Data, Arity, Compare>::Insert(const Data &value)
+{
+    return Push(value);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+typename IndexedPQHeap<Data, Arity, Compare>::Handle IndexedPQHeap<Data, Arity, Compare>::Insert(Data &&value)
+{
+    return Push(std::move(value));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool IndexedPQHeap<Data, Arity, Compare>::Contains(Handle handle) const noexcept
+{
+    return (handle < handles && Positions[handle] != Absent);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline const Data & IndexedPQHeap<Data, Arity, Compare>::operator[](Handle handle) const
+{
+    return Elements[PositionOf(handle)];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::Change(Handle handle, const Data &value)
+{
+    Update(handle, value);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::Change(Handle handle, Data &&value)
+{
+    Update(handle, std::move(value));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::Remove(Handle handle)
+{
+    RemoveAt(PositionOf(handle));
+}
+
+/* ---------------------------IndexedPQHeap: Specific member function (inherited from TraversableContainer)-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::Traverse(TraverseFun fun) const
+{
+    for(ulong i = 0; i < size; i++)
+        fun(Elements[i]);
+}
+
+/* ---------------------------IndexedPQHeap: Specific member function (inherited from ClearableContainer)-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::Clear()
+{
+    delete[] Elements;
+    delete[] Handles;
+    delete[] Positions;
+    delete[] Free;
+
+    Elements = nullptr;
+    Handles = nullptr;
+    Positions = nullptr;
+    Free = nullptr;
+
+    size = handles = free = capacity = 0;
+}
+
+/* ---------------------------IndexedPQHeap: Auxiliary functions-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong IndexedPQHeap<Data, Arity, Compare>::PositionOf(Handle handle) const
+{
+    if(!Contains(handle))
+        throw std::out_of_range("Handle Not Found from IndexedPQHeap");
+
+    return Positions[handle];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+template <typename Value>
+typename IndexedPQHeap<Data, Arity, Compare>::Handle IndexedPQHeap<Data, Arity, Compare>::Push(Value &&value)
+{
+    // I handle liberati si riusano: le posizioni crescono solo quando servono handle nuovi
+    if(free == 0 && handles == capacity)
+        Grow();
+
+    Handle handle = (free > 0) ? Free[--free] : handles++;
+
+    Elements[size] = std::forward<Value>(value);
+    Handles[size] = handle;
+    Positions[handle] = size;
+
+    HeapifyUp(size++);
+
+    return handle;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+template <typename Value>
+void IndexedPQHeap<Data, Arity, Compare>::Update(Handle handle, Value &&value)
+{
+    ulong position = PositionOf(handle);
+
+    // Il confronto precede l'assegnamento: dopo lo spostamento il valore non e' piu' utilizzabile
+    bool up = compare(Elements[position], value);
+    bool down = compare(value, Elements[position]);
+
+    Elements[position] = std::forward<Value>(value);
+
+    if(up)
+        HeapifyUp(position);
+    else if(down)
+        HeapifyDown(position);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::RemoveAt(ulong position)
+{
+    Handle handle = Handles[position];
+
+    Positions[handle] = Absent;
+    Free[free++] = handle;
+
+    // L'ultimo elemento prende il posto di quello rimosso e sale o scende
+    if(position != --size)
+    {
+        Elements[position] = std::move(Elements[size]);
+        Handles[position] = Handles[size];
+        Positions[Handles[position]] = position;
+
+        if(position > 0 && compare(Elements[Parent(position)], Elements[position]))
+            HeapifyUp(position);
+        else
+            HeapifyDown(position);
+    }
+
+    Elements[size] = Data {};
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::HeapifyUp(ulong index) noexcept
+{
+    Data value = std::move(Elements[index]);
+    Handle handle = Handles[index];
+
+    while(index > 0 && compare(Elements[Parent(index)], value))
+    {
+        ulong parent = Parent(index);
+
+        Elements[index] = std::move(Elements[parent]);
+        Handles[index] = Handles[parent];
+        Positions[Handles[index]] = index;
+
+        index = parent;
+    }
+
+    Elements[index] = std::move(value);
+    Handles[index] = handle;
+    Positions[handle] = index;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::HeapifyDown(ulong index) noexcept
+{
+    Data value = std::move(Elements[index]);
+    Handle handle = Handles[index];
+    ulong first;
+
+    while((first = FirstChild(index)) < size)
+    {
+        ulong max = first;
+        ulong last = std::min(first + Arity, size);
+
+        for(ulong child = first + 1; child < last; child++)
+            if(compare(Elements[max], Elements[child]))
+                max = child;
+
+        if(!compare(value, Elements[max]))
+            break;
+
+        Elements[index] = std::move(Elements[max]);
+        Handles[index] = Handles[max];
+        Positions[Handles[index]] = index;
+
+        index = max;
+    }
+
+    Elements[index] = std::move(value);
+    Handles[index] = handle;
+    Positions[handle] = index;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void IndexedPQHeap<Data, Arity, Compare>::Grow()
+{
+    ulong newCapacity = std::max(capacity * 2, 2UL);
+
+    Data * newElements = new Data[newCapacity] {};
+    Handle * newHandles = new Handle[newCapacity];
+    ulong * newPositions = new ulong[newCapacity];
+    Handle * newFree = new Handle[newCapacity];
+
+    std::move(Elements, Elements + size, newElements);
+    std::copy(Handles, Handles + size, newHandles);
+    std::copy(Positions, Positions + handles, newPositions);
+    std::copy(Free, Free + free, newFree);
+
+    std::swap(Elements, newElements);
+    std::swap(Handles, newHandles);
+    std::swap(Positions, newPositions);
+    std::swap(Free, newFree);
+
+    delete[] newElements;
+    delete[] newHandles;
+    delete[] newPositions;
+    delete[] newFree;
+
+    capacity = newCapacity;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,160 @@
+
+#ifndef INDEXEDPQHEAP_HPP
+#define INDEXEDPQHEAP_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../../container/container.hpp"
+#include "../../container/traversable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Priority queue (maximum according to Compare on top) whose elements are reached through handles: Insert returns
+// a handle that stays valid while the element is in the queue, whatever happens to the others.
+// A position map, updated at every move of the sifts, gives Change and Remove in O(log n).
+// The handle of a removed element may be given to a later Insert.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class IndexedPQHeap : virtual public TraversableContainer<Data>,
+                      virtual public ClearableContainer{
+  // Must extend TraversableContainer<Data>,
+  //             ClearableContainer
+
+  static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+private:
+
+  // ...
+
+public:
+
+  using Handle = ulong;
+
+protected:
+
+  using Container::size;
+
+  static constexpr ulong Absent = ~0UL; // Position of a handle not in the queue
+
+  Data * Elements = nullptr; // Heap order
+  Handle * Handles = nullptr; // Handle of the element in each heap position
+  ulong * Positions = nullptr; // Heap position of each handle (Absent when free)
+  Handle * Free = nullptr; // Stack of the released handles
+
+  ulong handles = 0; // Handles given so far
+  ulong free = 0;
+  ulong capacity = 0;
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
+public:
+
+  // Default constructor
+  IndexedPQHeap() = default;
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  IndexedPQHeap(const IndexedPQHeap &);
+
+  // Move constructor
+  IndexedPQHeap(IndexedPQHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~IndexedPQHeap();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  IndexedPQHeap & operator=(const IndexedPQHeap &);
+
+  // Move assignment
+  IndexedPQHeap & operator=(IndexedPQHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const IndexedPQHeap &) const noexcept; // (same handles with the same values)
+  inline bool operator!=(const IndexedPQHeap &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline const Data & Tip() const; // (must throw std::length_error when empty)
+  inline Handle TipHandle() const; // (must throw std::length_error when empty)
+
+  void RemoveTip(); // (must throw std::length_error when empty)
+  Data TipNRemove(); // (must throw std::length_error when empty)
+
+  Handle Insert(const Data &); // Copy of the value
+  Handle Insert(Data &&); // Move of the value
+
+  inline bool Contains(Handle) const noexcept;
+
+  inline const Data & operator[](Handle) const; // (must throw std::out_of_range when the handle is not in the queue)
+
+  void Change(Handle, const Data &); // Copy of the value (must throw std::out_of_range when the handle is not in the queue)
+  void Change(Handle, Data &&); // Move of the value (must throw std::out_of_range when the handle is not in the queue)
+
+  void Remove(Handle); // (must throw std::out_of_range when the handle is not in the queue)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Override TraversableContainer member (heap order)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions
+
+  static inline constexpr ulong FirstChild(ulong index) noexcept { return Arity * index + 1; }
+  static inline constexpr ulong Parent(ulong index) noexcept { return (index - 1) / Arity; }
+
+  inline ulong PositionOf(Handle) const; // (must throw std::out_of_range when the handle is not in the queue)
+
+  template <typename Value>
+  Handle Push(Value &&);
+
+  template <typename Value>
+  void Update(Handle, Value &&);
+
+  void RemoveAt(ulong);
+
+  void HeapifyUp(ulong) noexcept; // Sift up moving a hole; the position map follows every move
+  void HeapifyDown(ulong) noexcept; // Sift down moving a hole; the position map follows every move
+
+  void Grow();
+
+};
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity = 2>
+using MinIndexedPQHeap = IndexedPQHeap<Data, Arity, std::greater<Data>>;
+
+/* ************************************************************************** */
+
+}
+
+#include "indexedpqheap.cpp"
+
+#endif
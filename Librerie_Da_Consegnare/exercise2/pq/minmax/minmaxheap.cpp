@@ -0,0 +1,421 @@
+#include <algorithm>
+
+#include "minmaxheap.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------MinMaxHeap: Constructors/Destructors -------------------------- */
+
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare>::MinMaxHeap() : Vector<Data>(2)
+{
+    capacity = size;
+    size = 0;
+}
+
+// A min-max heap obtained from a TraversableContainer
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare>::MinMaxHeap(const TraversableContainer<Data> &cont) : Vector<Data>(cont)
+{
+    capacity = size;
+
+    Heapify();
+
+    if(size < 2)
+        Resize(2);
+}
+
+// A min-max heap obtained from a MappableContainer
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare>::MinMaxHeap(MappableContainer<Data> &&cont) : Vector<Data>(std::move(cont))
+{
+    capacity = size;
+
+    Heapify();
+
+    if(size < 2)
+        Resize(2);
+}
+
+// Copy constructor
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare>::MinMaxHeap(const MinMaxHeap &heap) : Vector<Data>(heap)
+{
+    capacity = size;
+
+    if(size < 2)
+        Resize(2);
+}
+
+// Move constructor
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare>::MinMaxHeap(MinMaxHeap &&heap) noexcept : Vector<Data>(std::move(heap))
+{
+    std::swap(capacity, heap.capacity);
+}
+
+/* ---------------------------MinMaxHeap: Assignments -------------------------- */
+
+// Copy assignment
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare> & MinMaxHeap<Data, Compare>::operator=(const MinMaxHeap &heap)
+{
+    MinMaxHeap<Data, Compare> * tmp = new MinMaxHeap<Data, Compare>(heap);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, typename Compare>
+MinMaxHeap<Data, Compare> & MinMaxHeap<Data, Compare>::operator=(MinMaxHeap &&heap) noexcept
+{
+    Vector<Data>::operator=(std::move(heap));
+    std::swap(capacity, heap.capacity);
+
+    return *this;
+}
+
+/* ---------------------------MinMaxHeap: Comparison Operators-------------------------- */
+
+template <typename Data, typename Compare>
+bool MinMaxHeap<Data, Compare>::operator==(const MinMaxHeap &heap) const noexcept
+{
+    return Vector<Data>::operator==(heap);
+}
+
+template <typename Data, typename Compare>
+inline bool MinMaxHeap<Data, Compare>::operator!=(const MinMaxHeap &heap) const noexcept
+{
+    return !((*this) == heap);
+}
+
+/* ---------------------------MinMaxHeap: Specific member functions -------------------------- */
+
+template <typename Data, typename Compare>
+inline const Data & MinMaxHeap<Data, Compare>::Min() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: MinMaxHeap is empty");
+
+    return Elements[0];
+}
+
+template <typename Data, typename Compare>
+inline const Data & MinMaxHeap<Data, Compare>::Max() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: MinMaxHeap is empty");
+
+    return Elements[MaxIndex()];
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::RemoveMin()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: MinMaxHeap is empty");
+
+    RemoveAt(0);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::RemoveMax()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: MinMaxHeap is empty");
+
+    RemoveAt(MaxIndex());
+}
+
+template <typename Data, typename Compare>
+Data MinMaxHeap<Data, Compare>::MinNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: MinMaxHeap is empty");
+
+    Data min = std::move(Elements[0]);
+
+    RemoveAt(0);
+
+    return min;
+}
+
+template <typename Data, typename Compare>
+Data MinMaxHeap<Data, Compare>::MaxNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: MinMaxHeap is empty");
+
+    ulong index = MaxIndex();
+    Data max = std::move(Elements[index]);
+
+    RemoveAt(index);
+
+    return max;
+}
+
+// Ogni nodo rispetta il padre e il nonno (che stanno su livelli di tipo diverso e uguale)
+template <typename Data, typename Compare>
+bool MinMaxHeap<Data, Compare>::IsHeap() const noexcept
+{
+    for(ulong i = 1; i < size; i++)
+    {
+        ulong parent = Parent(i);
+
+        if(Before(MinLevel(parent), Elements[i], Elements[parent]))
+            return false;
+
+        if(i > 2 && Before(MinLevel(i), Elements[i], Elements[Parent(parent)]))
+            return false;
+    }
+
+    return true;
+}
+
+/* ---------------------------MinMaxHeap: Specific member functions (inherited from PQ) -------------------------- */
+
+template <typename Data, typename Compare>
+inline const Data & MinMaxHeap<Data, Compare>::Tip() const
+{
+    return Max();
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::RemoveTip()
+{
+    RemoveMax();
+}
+
+template <typename Data, typename Compare>
+Data MinMaxHeap<Data, Compare>::TipNRemove()
+{
+    return MaxNRemove();
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Insert(const Data &value)
+{
+    checkResize();
+
+    Elements[size++] = value;
+
+    Restore(size - 1);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Insert(Data &&value)
+{
+    checkResize();
+
+    Elements[size++] = std::move(value);
+
+    Restore(size - 1);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Change(ulong index, const Data &value)
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from MinMaxHeap");
+
+    Elements[index] = value;
+
+    Restore(index);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Change(ulong index, Data &&value)
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from MinMaxHeap");
+
+    Elements[index] = std::move(value);
+
+    Restore(index);
+}
+
+/* ---------------------------MinMaxHeap: Specific member function (inherited from LinearContainer) -------------------------- */
+
+template <typename Data, typename Compare>
+inline const Data & MinMaxHeap<Data, Compare>::operator[](ulong index) const
+{
+    return Vector<Data>::operator[](index);
+}
+
+/* ---------------------------MinMaxHeap: Specific member function (inherited from ClearableContainer) -------------------------- */
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Clear()
+{
+    delete[] Elements;
+    Elements = new Data[2] {};
+    capacity = 2;
+    size = 0;
+}
+
+/* ---------------------------MinMaxHeap: Auxilary functions -------------------------- */
+
+// Sui livelli min un valore precede l'altro se e' minore, sui livelli max se e' maggiore
+template <typename Data, typename Compare>
+inline bool MinMaxHeap<Data, Compare>::Before(bool min, const Data &fst, const Data &snd) const noexcept
+{
+    return min ? compare(fst, snd) : compare(snd, fst);
+}
+
+template <typename Data, typename Compare>
+inline ulong MinMaxHeap<Data, Compare>::MaxIndex() const noexcept
+{
+    if(size < 3)
+        return size - 1;
+
+    return compare(Elements[1], Elements[2]) ? 2 : 1;
+}
+
+// Il nuovo valore viola al piu' un lato: se supera il padre (livello opposto) i due si
+// scambiano, il valore sale tra i nonni del padre e il vecchio padre scende nel sottoalbero;
+// altrimenti sale tra i propri nonni oppure scende tra i propri nipoti
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Restore(ulong index) noexcept
+{
+    if(index > 0)
+    {
+        ulong parent = Parent(index);
+
+        if(Before(MinLevel(parent), Elements[index], Elements[parent]))
+        {
+            std::swap(Elements[index], Elements[parent]);
+            BubbleUp(parent);
+            TrickleDown(index);
+
+            return;
+        }
+
+        if(BubbleUp(index))
+            return;
+    }
+
+    TrickleDown(index);
+}
+
+template <typename Data, typename Compare>
+bool MinMaxHeap<Data, Compare>::BubbleUp(ulong index) noexcept
+{
+    bool min = MinLevel(index);
+
+    if(index < 3 || !Before(min, Elements[index], Elements[Parent(Parent(index))]))
+        return false;
+
+    Data value = std::move(Elements[index]);
+    ulong hole = index;
+    ulong grand;
+
+    while(hole > 2 && Before(min, value, Elements[grand = Parent(Parent(hole))]))
+    {
+        Elements[hole] = std::move(Elements[grand]);
+        hole = grand;
+    }
+
+    Elements[hole] = std::move(value);
+
+    return true;
+}
+
+// Il buco scende verso il nipote che precede tutti i figli e nipoti; se a precederli e' un figlio
+// (che non ha nipoti piu' estremi) il valore si ferma li'
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::TrickleDown(ulong index) noexcept
+{
+    bool min = MinLevel(index);
+    Data value = std::move(Elements[index]);
+    ulong hole = index;
+    ulong first;
+
+    while((first = 2 * hole + 1) < size)
+    {
+        ulong best = first;
+
+        if(first + 1 < size && Before(min, Elements[first + 1], Elements[best]))
+            best = first + 1;
+
+        for(ulong grand = 2 * first + 1; grand < std::min(2 * first + 5, size); grand++)
+            if(Before(min, Elements[grand], Elements[best]))
+                best = grand;
+
+        if(!Before(min, Elements[best], value))
+            break;
+
+        Elements[hole] = std::move(Elements[best]);
+        hole = best;
+
+        if(best < 2 * first + 1)
+            break;
+
+        // Il nipote e' sotto un nodo del livello opposto, che deve restare piu' estremo del valore
+        ulong parent = Parent(best);
+
+        if(Before(min, Elements[parent], value))
+            std::swap(value, Elements[parent]);
+    }
+
+    Elements[hole] = std::move(value);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Heapify() noexcept
+{
+    for(ulong i = size / 2; i > 0; i--)
+        TrickleDown(i - 1);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::RemoveAt(ulong index)
+{
+    if(index != --size)
+    {
+        Elements[index] = std::move(Elements[size]);
+        Restore(index);
+    }
+
+    checkResize();
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::checkResize()
+{
+    if(capacity < 2)
+    {
+        delete[] Elements;
+
+        Elements = new Data[2] {};
+        capacity = 2;
+        size = 0;
+    }
+    else if(static_cast<double>(size) / capacity <= 0.25 && capacity > 2)
+        Resize(std::max(capacity / 2, 2UL));
+    else if(static_cast<double>(size) / capacity >= 0.9)
+        Resize(capacity * 2);
+}
+
+template <typename Data, typename Compare>
+void MinMaxHeap<Data, Compare>::Resize(const ulong newCapacity)
+{
+    Data * resElements = new Data[newCapacity] {};
+
+    for(ulong i = 0; i < size; i++)
+        resElements[i] = std::move(Elements[i]);
+
+    std::swap(Elements, resElements);
+
+    capacity = newCapacity;
+
+    delete[] resElements;
+}
+
+/* ************************************************************************** */
+
+}
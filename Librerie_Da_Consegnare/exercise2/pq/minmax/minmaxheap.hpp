@@ -0,0 +1,156 @@
+
+#ifndef MINMAXHEAP_HPP
+#define MINMAXHEAP_HPP
+
+/* ************************************************************************** */
+
+#include <bit>
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Min-max heap: a binary heap whose even levels (the root's included) are min levels and odd
+// levels are max levels. A node on a min level precedes every element of its subtree according
+// to Compare, a node on a max level follows them: the minimum is the root and the maximum one of
+// its children. Both ends are read in O(1) and removed in O(log n) on a single array.
+// The tip of the PQ interface is the maximum, as in PQHeap.
+
+template <typename Data, typename Compare = std::less<Data>>
+class MinMaxHeap : virtual public PQ<Data>,
+                   virtual protected Vector<Data> {
+  // Must extend PQ<Data>,
+  // Could extend Vector<Data>
+
+private:
+
+
+protected:
+
+  using Container::size;
+  using Vector<Data>::Elements;
+
+  ulong capacity = 0;
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
+public:
+
+  using Vector<Data>::Front;
+  using Vector<Data>::Back;
+  using Vector<Data>::Exists;
+
+  // Default constructor
+  MinMaxHeap();
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  MinMaxHeap(const TraversableContainer<Data> &); // A min-max heap obtained from a TraversableContainer
+  MinMaxHeap(MappableContainer<Data> &&); // A min-max heap obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  MinMaxHeap(const MinMaxHeap &);
+
+  // Move constructor
+  MinMaxHeap(MinMaxHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~MinMaxHeap() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  MinMaxHeap & operator=(const MinMaxHeap &);
+
+  // Move assignment
+  MinMaxHeap & operator=(MinMaxHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const MinMaxHeap &) const noexcept; // (same values in the same positions)
+  inline bool operator!=(const MinMaxHeap &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline const Data & Min() const; // (must throw std::length_error when empty)
+  inline const Data & Max() const; // (must throw std::length_error when empty)
+
+  void RemoveMin(); // (must throw std::length_error when empty)
+  void RemoveMax(); // (must throw std::length_error when empty)
+
+  Data MinNRemove(); // (must throw std::length_error when empty)
+  Data MaxNRemove(); // (must throw std::length_error when empty)
+
+  bool IsHeap() const noexcept; // Checks the invariants of every level
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  inline const Data & Tip() const override; // Override PQ member (the maximum; must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data &) override; // Override PQ member (Copy of the value)
+  void Insert(Data &&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data &) override; // Override PQ member (Copy of the value)
+  void Change(ulong, Data &&) override; // Override PQ member (Move of the value)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from LinearContainer)
+
+  inline const Data & operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions
+
+  static inline constexpr ulong Parent(ulong index) noexcept { return (index - 1) / 2; }
+  static inline constexpr bool MinLevel(ulong index) noexcept { return std::bit_width(index + 1) % 2 == 1; }
+
+  inline bool Before(bool, const Data &, const Data &) const noexcept; // Order of a min level (true) or of a max level (false)
+  inline ulong MaxIndex() const noexcept;
+
+  void Restore(ulong) noexcept; // Moves a new value at the given position to its place
+  bool BubbleUp(ulong) noexcept; // Up along the grandparents on the same kind of level, true if it moved
+  void TrickleDown(ulong) noexcept; // Down along the grandchildren on the same kind of level
+  void Heapify() noexcept;
+
+  void RemoveAt(ulong);
+
+  void checkResize();
+  void Resize(const ulong) override;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "minmaxheap.cpp"
+
+#endif
@@ -0,0 +1,629 @@
+#include <algorithm>
+
+#include "pqpairing.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------PQPairing: Constructors/Destructors -------------------------- */
+
+// A priority queue obtained from a TraversableContainer
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(const TraversableContainer<Data> &cont)
+{
+    cont.Traverse
+    (
+        [this] (const Data &curr)
+        {
+            Insert(curr);
+        }
+    );
+}
+
+// A priority queue obtained from a MappableContainer
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(MappableContainer<Data> &&cont)
+{
+    cont.Map
+    (
+        [this] (Data &curr)
+        {
+            Insert(std::move(curr));
+        }
+    );
+}
+
+// Copy constructor
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(const PQPairing &pq)
+{
+    if(pq.size == 0)
+        return;
+
+    pq.BuildIndex();
+
+    // Un solo chunk: il nodo i della copia corrisponde al nodo in posizione i dell'originale
+    chunks = lastChunk = new Chunk {new Node[pq.size], pq.size, nullptr};
+    Index = new Node * [pq.size];
+    indexCapacity = pq.size;
+
+    Node * nodes = chunks->nodes;
+    auto copy = [nodes] (const Node * node) { return (node != nullptr) ? nodes + node->where : nullptr; };
+
+    for(ulong i = 0; i < pq.size; i++)
+    {
+        const Node * src = pq.Index[i];
+
+        nodes[i].value = src->value;
+        nodes[i].child = copy(src->child);
+        nodes[i].next = copy(src->next);
+        nodes[i].prev = copy(src->prev);
+        nodes[i].where = i;
+        Index[i] = nodes + i;
+    }
+
+    root = copy(pq.root);
+    size = pq.size;
+}
+
+// Move constructor
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(PQPairing &&pq) noexcept
+{
+    Swap(pq);
+}
+
+// Destructor
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::~PQPairing()
+{
+    while(chunks != nullptr)
+    {
+        Chunk * chunk = chunks;
+        chunks = chunk->next;
+
+        delete[] chunk->nodes;
+        delete chunk;
+    }
+
+    delete[] Index;
+}
+
+/* ---------------------------PQPairing: Assignments -------------------------- */
+
+// Copy assignment
+template <typename Data, typename Compare>
+PQPairing<Data, Compare> & PQPairing<Data, Compare>::operator=(const PQPairing &pq)
+{
+    PQPairing<Data, Compare> * tmp = new PQPairing<Data, Compare>(pq);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, typename Compare>
+PQPairing<Data, Compare> & PQPairing<Data, Compare>::operator=(PQPairing &&pq) noexcept
+{
+    Swap(pq);
+
+    return *this;
+}
+
+/* ---------------------------PQPairing: Comparison Operators-------------------------- */
+
+template <typename Data, typename Compare>
+bool PQPairing<Data, Compare>::operator==(const PQPairing &pq) const noexcept
+{
+    if(size != pq.size)
+        return false;
+
+    BuildIndex();
+    pq.BuildIndex();
+
+    for(ulong i = 0; i < size; i++)
+        if(Index[i]->value != pq.Index[i]->value)
+            return false;
+
+    return true;
+}
+
+template <typename Data, typename Compare>
+inline bool PQPairing<Data, Compare>::operator!=(const PQPairing &pq) const noexcept
+{
+    return !((*this) == pq);
+}
+
+/* ---------------------------PQPairing: Specific member functions -------------------------- */
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Handle PQPairing<Data, Compare>::Push(const Data &value)
+{
+    return Handle(Add(value));
+}
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Handle PQPairing<Data, Compare>::Push(Data &&value)
+{
+    return Handle(Add(std::move(value)));
+}
+
+template <typename Data, typename Compare>
+inline typename PQPairing<Data, Compare>::Handle PQPairing<Data, Compare>::TipHandle() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQPairing is empty");
+
+    return Handle(root);
+}
+
+template <typename Data, typename Compare>
+inline bool PQPairing<Data, Compare>::Contains(Handle handle) const noexcept
+{
+    return (handle.node != nullptr && handle.node->where != Absent);
+}
+
+template <typename Data, typename Compare>
+inline const Data & PQPairing<Data, Compare>::operator[](Handle handle) const
+{
+    return NodeOf(handle)->value;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(Handle handle, const Data &value)
+{
+    Update(NodeOf(handle), value);
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(Handle handle, Data &&value)
+{
+    Update(NodeOf(handle), std::move(value));
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Remove(Handle handle)
+{
+    Node * node = NodeOf(handle);
+
+    Detach(node);
+    IndexRemove(node);
+    Release(node);
+}
+
+// Le radici si collegano e i chunk dell'altra coda passano a questa: nessun nodo si sposta.
+// Dell'ultimo chunk dell'altra coda restano inutilizzati i nodi mai consegnati
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Meld(PQPairing &&pq)
+{
+    if(this == &pq || pq.chunks == nullptr)
+        return;
+
+    if(chunks == nullptr)
+    {
+        chunks = pq.chunks;
+        unused = pq.unused;
+    }
+    else
+        lastChunk->next = pq.chunks;
+
+    lastChunk = pq.lastChunk;
+
+    if(pq.free != nullptr)
+    {
+        pq.lastFree->next = free;
+        free = pq.free;
+
+        if(lastFree == nullptr)
+            lastFree = pq.lastFree;
+    }
+
+    if(pq.root != nullptr)
+    {
+        root = (root != nullptr) ? Link(root, pq.root) : pq.root;
+        size += pq.size;
+        indexed = false;
+    }
+
+    pq.root = nullptr;
+    pq.chunks = pq.lastChunk = nullptr;
+    pq.unused = 0;
+    pq.free = pq.lastFree = nullptr;
+    pq.size = 0;
+    pq.indexed = true;
+}
+
+/* ---------------------------PQPairing: Specific member functions (inherited from PQ) -------------------------- */
+
+template <typename Data, typename Compare>
+inline const Data & PQPairing<Data, Compare>::Tip() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQPairing is empty");
+
+    return root->value;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::RemoveTip()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQPairing is empty");
+
+    Node * tip = root;
+
+    root = TwoPass(tip->child);
+    IndexRemove(tip);
+    Release(tip);
+}
+
+template <typename Data, typename Compare>
+Data PQPairing<Data, Compare>::TipNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQPairing is empty");
+
+    Data tip = std::move(root->value);
+
+    RemoveTip();
+
+    return tip;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Insert(const Data &value)
+{
+    Add(value);
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Insert(Data &&value)
+{
+    Add(std::move(value));
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(ulong index, const Data &value)
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from PQPairing");
+
+    BuildIndex();
+    Update(Index[index], value);
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(ulong index, Data &&value)
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from PQPairing");
+
+    BuildIndex();
+    Update(Index[index], std::move(value));
+}
+
+/* ---------------------------PQPairing: Specific member function (inherited from LinearContainer) -------------------------- */
+
+template <typename Data, typename Compare>
+const Data & PQPairing<Data, Compare>::operator[](ulong index) const
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from PQPairing");
+
+    BuildIndex();
+
+    return Index[index]->value;
+}
+
+/* ---------------------------PQPairing: Specific member function (inherited from TraversableContainer) -------------------------- */
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Traverse(TraverseFun fun) const
+{
+    BuildIndex();
+
+    for(ulong i = 0; i < size; i++)
+        fun(Index[i]->value);
+}
+
+/* ---------------------------PQPairing: Specific member function (inherited from ClearableContainer) -------------------------- */
+
+// I chunk restano alla coda: ogni nodo in uso torna nella free list come Absent, cosi' Contains
+// resta sicuro sugli handle rilasciati. Solo il distruttore libera la memoria dei nodi
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Clear()
+{
+    for(Chunk * chunk = chunks; chunk != nullptr; chunk = chunk->next)
+        for(ulong i = 0; i < chunk->count; i++)
+            if(chunk->nodes[i].where != Absent)
+                Release(chunk->nodes + i);
+
+    delete[] Index;
+
+    root = nullptr;
+    Index = nullptr;
+    indexCapacity = 0;
+    indexed = true;
+    size = 0;
+}
+
+/* ---------------------------PQPairing: Auxilary functions -------------------------- */
+
+// I chunk raddoppiano fino a ChunkMax nodi; i nodi liberati tornano in testa alla free list
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node * PQPairing<Data, Compare>::Acquire()
+{
+    if(free != nullptr)
+    {
+        Node * node = free;
+
+        free = node->next;
+        if(free == nullptr)
+            lastFree = nullptr;
+
+        node->next = nullptr;
+        return node;
+    }
+
+    if(unused == 0)
+    {
+        ulong count = (chunks != nullptr) ? std::min(2 * chunks->count, ChunkMax) : ChunkMin;
+        Chunk * chunk = new Chunk {new Node[count], count, chunks};
+
+        if(chunks == nullptr)
+            lastChunk = chunk;
+
+        chunks = chunk;
+        unused = count;
+    }
+
+    return chunks->nodes + (chunks->count - unused--);
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Release(Node * node) noexcept
+{
+    node->value = Data {};
+    node->child = node->prev = nullptr;
+    node->where = Absent;
+
+    node->next = free;
+    free = node;
+
+    if(lastFree == nullptr)
+        lastFree = node;
+}
+
+// La radice con priorita' minore diventa il primo figlio dell'altra
+template <typename Data, typename Compare>
+inline typename PQPairing<Data, Compare>::Node * PQPairing<Data, Compare>::Link(Node * fst, Node * snd) noexcept
+{
+    if(compare(fst->value, snd->value))
+        std::swap(fst, snd);
+
+    snd->prev = fst;
+    snd->next = fst->child;
+
+    if(fst->child != nullptr)
+        fst->child->prev = snd;
+
+    fst->child = snd;
+
+    return fst;
+}
+
+template <typename Data, typename Compare>
+inline void PQPairing<Data, Compare>::Cut(Node * node) noexcept
+{
+    if(node->prev->child == node)
+        node->prev->child = node->next;
+    else
+        node->prev->next = node->next;
+
+    if(node->next != nullptr)
+        node->next->prev = node->prev;
+
+    node->next = node->prev = nullptr;
+}
+
+// Primo passo: fusione a coppie da sinistra, i risultati in una pila (collegata con prev).
+// Secondo passo: fusione da destra, svuotando la pila
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node * PQPairing<Data, Compare>::TwoPass(Node * first) noexcept
+{
+    Node * stack = nullptr;
+
+    while(first != nullptr)
+    {
+        Node * fst = first;
+        Node * snd = fst->next;
+
+        fst->next = fst->prev = nullptr;
+
+        if(snd == nullptr)
+        {
+            fst->prev = stack;
+            stack = fst;
+            break;
+        }
+
+        first = snd->next;
+        snd->next = snd->prev = nullptr;
+
+        Node * pair = Link(fst, snd);
+        pair->prev = stack;
+        stack = pair;
+    }
+
+    if(stack == nullptr)
+        return nullptr;
+
+    Node * result = stack;
+    stack = stack->prev;
+    result->prev = nullptr;
+
+    while(stack != nullptr)
+    {
+        Node * tree = stack;
+        stack = stack->prev;
+        tree->prev = nullptr;
+
+        result = Link(tree, result);
+    }
+
+    return result;
+}
+
+// I figli del nodo si fondono in un unico albero che prende il suo posto
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Detach(Node * node) noexcept
+{
+    Node * children = TwoPass(node->child);
+    node->child = nullptr;
+
+    if(node == root)
+        root = children;
+    else
+    {
+        Cut(node);
+
+        if(children != nullptr)
+            root = Link(root, children);
+    }
+}
+
+template <typename Data, typename Compare>
+template <typename Value>
+typename PQPairing<Data, Compare>::Node * PQPairing<Data, Compare>::Add(Value &&value)
+{
+    Node * node = Acquire();
+
+    node->value = std::forward<Value>(value);
+    IndexAppend(node);
+
+    root = (root != nullptr) ? Link(root, node) : node;
+
+    return node;
+}
+
+// Aumento di priorita': si stacca il sottoalbero e lo si collega alla radice, O(1).
+// Diminuzione: il nodo esce dall'albero (i figli restano) e rientra come radice a se'
+template <typename Data, typename Compare>
+template <typename Value>
+void PQPairing<Data, Compare>::Update(Node * node, Value &&value)
+{
+    // Il confronto precede lo spostamento: dopo std::move il valore non e' piu' utilizzabile
+    bool up = compare(node->value, value);
+    bool down = compare(value, node->value);
+
+    node->value = std::forward<Value>(value);
+
+    if(up && node != root)
+    {
+        Cut(node);
+        root = Link(root, node);
+    }
+    else if(down)
+    {
+        Detach(node);
+        root = (root != nullptr) ? Link(root, node) : node;
+    }
+}
+
+template <typename Data, typename Compare>
+inline typename PQPairing<Data, Compare>::Node * PQPairing<Data, Compare>::NodeOf(Handle handle) const
+{
+    if(!Contains(handle))
+        throw std::out_of_range("Handle Not Found from PQPairing");
+
+    return handle.node;
+}
+
+// Dopo un Meld l'indice si ricostruisce con una visita in ampiezza che usa l'indice stesso come coda
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::BuildIndex() const
+{
+    if(indexed)
+        return;
+
+    if(indexCapacity < size)
+    {
+        delete[] Index;
+        Index = new Node * [size];
+        indexCapacity = size;
+    }
+
+    ulong tail = 0;
+
+    if(root != nullptr)
+        Index[tail++] = root;
+
+    for(ulong i = 0; i < tail; i++)
+    {
+        Index[i]->where = i;
+
+        for(Node * child = Index[i]->child; child != nullptr; child = child->next)
+            Index[tail++] = child;
+    }
+
+    indexed = true;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::IndexAppend(Node * node)
+{
+    if(indexed)
+    {
+        if(size == indexCapacity)
+        {
+            ulong newCapacity = std::max(2 * indexCapacity, ChunkMin);
+            Node ** newIndex = new Node * [newCapacity];
+
+            std::copy(Index, Index + size, newIndex);
+            delete[] Index;
+
+            Index = newIndex;
+            indexCapacity = newCapacity;
+        }
+
+        Index[size] = node;
+    }
+
+    node->where = size++;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::IndexRemove(Node * node) noexcept
+{
+    size--;
+
+    if(indexed)
+    {
+        Node * last = Index[size];
+
+        Index[node->where] = last;
+        last->where = node->where;
+    }
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Swap(PQPairing &pq) noexcept
+{
+    std::swap(root, pq.root);
+    std::swap(chunks, pq.chunks);
+    std::swap(lastChunk, pq.lastChunk);
+    std::swap(unused, pq.unused);
+    std::swap(free, pq.free);
+    std::swap(lastFree, pq.lastFree);
+    std::swap(Index, pq.Index);
+    std::swap(indexCapacity, pq.indexCapacity);
+    std::swap(indexed, pq.indexed);
+    std::swap(size, pq.size);
+}
+
+/* ************************************************************************** */
+
+}
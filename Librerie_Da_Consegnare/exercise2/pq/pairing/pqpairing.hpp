@@ -0,0 +1,232 @@
+
+#ifndef PQPAIRING_HPP
+#define PQPAIRING_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Pairing heap: a multiway tree kept as child/sibling lists. Insert, Meld and a change that
+// raises a priority link two trees in O(1); RemoveTip merges the children of the root in two
+// passes (pairs from left to right, then from right to left), O(log n) amortized.
+// Nodes are carved out of chunks owned by the queue and recycled through a free list: a node
+// never moves, so a Handle stays valid until its element leaves the queue (even across a Meld).
+// Clear recycles the nodes but keeps the chunks, so Contains is still safe (false) on the handles
+// of a cleared queue; the chunks are freed by the destructor, and a Handle must not be used at all
+// once the queue holding its node has been destroyed or copy-assigned.
+// Positions (operator[], Change by position) go through an index of the nodes, rebuilt on the
+// first access by position after a Meld.
+
+template <typename Data, typename Compare = std::less<Data>>
+class PQPairing : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static constexpr ulong Absent = ~0UL; // Index position of a recycled node
+
+  struct Node {
+
+    // Data
+    Data value {};
+    Node * child = nullptr; // First child
+    Node * next = nullptr; // Right sibling (next free node when recycled)
+    Node * prev = nullptr; // Left sibling, or parent for the first child
+    ulong where = Absent; // Position in the index
+
+  };
+
+  struct Chunk {
+
+    // Data
+    Node * nodes = nullptr;
+    ulong count = 0;
+    Chunk * next = nullptr;
+
+  };
+
+  static constexpr ulong ChunkMin = 16;
+  static constexpr ulong ChunkMax = 1UL << 16;
+
+  Node * root = nullptr;
+
+  Chunk * chunks = nullptr; // The most recent chunk first: its unused nodes are handed out in order
+  Chunk * lastChunk = nullptr;
+  ulong unused = 0; // Nodes of the first chunk never handed out
+
+  Node * free = nullptr; // Recycled nodes
+  Node * lastFree = nullptr;
+
+  mutable Node ** Index = nullptr; // Nodes in position order
+  mutable ulong indexCapacity = 0;
+  mutable bool indexed = true; // False after a Meld, until the next access by position
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
+public:
+
+  // Reference to an element of the queue (valid in the queue that returned it, or in the one it was melded into;
+  // not to be used after that queue is destroyed or copy-assigned)
+  class Handle {
+
+    friend class PQPairing;
+
+  protected:
+
+    Node * node = nullptr;
+
+    explicit Handle(Node * ptr) : node(ptr) {}
+
+  public:
+
+    Handle() = default;
+
+    bool operator==(const Handle &) const noexcept = default;
+
+  };
+
+  // Default constructor
+  PQPairing() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQPairing(const TraversableContainer<Data> &); // A priority queue obtained from a TraversableContainer
+  PQPairing(MappableContainer<Data> &&); // A priority queue obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQPairing(const PQPairing &);
+
+  // Move constructor
+  PQPairing(PQPairing &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~PQPairing();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQPairing & operator=(const PQPairing &);
+
+  // Move assignment
+  PQPairing & operator=(PQPairing &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQPairing &) const noexcept; // (same values in the same positions)
+  inline bool operator!=(const PQPairing &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  Handle Push(const Data &); // Insert returning a handle (copy of the value)
+  Handle Push(Data &&); // Insert returning a handle (move of the value)
+
+  inline Handle TipHandle() const; // (must throw std::length_error when empty)
+
+  inline bool Contains(Handle) const noexcept; // (false for a handle whose element left, also after Clear; a released node may be reused by a later Push)
+
+  inline const Data & operator[](Handle) const; // (must throw std::out_of_range when the handle is not in the queue)
+
+  void Change(Handle, const Data &); // Copy of the value (must throw std::out_of_range when the handle is not in the queue)
+  void Change(Handle, Data &&); // Move of the value (must throw std::out_of_range when the handle is not in the queue)
+
+  void Remove(Handle); // (must throw std::out_of_range when the handle is not in the queue)
+
+  void Meld(PQPairing &&); // Moves every element of the given queue here in O(1); its handles stay valid
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  inline const Data & Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data &) override; // Override PQ member (Copy of the value)
+  void Insert(Data &&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data &) override; // Override PQ member (Copy of the value)
+  void Change(ulong, Data &&) override; // Override PQ member (Move of the value)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from LinearContainer)
+
+  const Data & operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Override TraversableContainer member (position order)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member (the nodes are recycled, their memory is kept until destruction)
+
+protected:
+
+  // Auxiliary functions
+
+  Node * Acquire(); // A node from the free list or from the current chunk
+  void Release(Node *) noexcept;
+
+  inline Node * Link(Node *, Node *) noexcept; // Root of the union of two trees
+  inline void Cut(Node *) noexcept; // Detaches a subtree from its parent
+  Node * TwoPass(Node *) noexcept; // Root of the union of a list of siblings
+  void Detach(Node *) noexcept; // Takes a node out of the tree (its children stay)
+
+  template <typename Value>
+  Node * Add(Value &&);
+
+  template <typename Value>
+  void Update(Node *, Value &&);
+
+  inline Node * NodeOf(Handle) const; // (must throw std::out_of_range when the handle is not in the queue)
+
+  void BuildIndex() const;
+  void IndexAppend(Node *);
+  void IndexRemove(Node *) noexcept;
+
+  void Swap(PQPairing &) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+template <typename Data>
+using MinPQPairing = PQPairing<Data, std::greater<Data>>;
+
+/* ************************************************************************** */
+
+}
+
+#include "pqpairing.cpp"
+
+#endif
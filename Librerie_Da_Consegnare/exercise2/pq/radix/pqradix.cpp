@@ -0,0 +1,352 @@
+#include <algorithm>
+#include <bit>
+
+#include "pqradix.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------PQRadix: Constructors/Destructors -------------------------- */
+
+// A priority queue obtained from a TraversableContainer
+template <typename Key, typename Value>
+PQRadix<Key, Value>::PQRadix(const TraversableContainer<Data> &cont)
+{
+    cont.Traverse
+    (
+        [this] (const Data &curr)
+        {
+            Insert(curr);
+        }
+    );
+}
+
+// A priority queue obtained from a MappableContainer
+template <typename Key, typename Value>
+PQRadix<Key, Value>::PQRadix(MappableContainer<Data> &&cont)
+{
+    cont.Map
+    (
+        [this] (Data &curr)
+        {
+            Insert(std::move(curr));
+        }
+    );
+}
+
+// Copy constructor
+template <typename Key, typename Value>
+PQRadix<Key, Value>::PQRadix(const PQRadix &pq)
+{
+    for(ulong b = 0; b <= Bits; b++)
+        if(pq.buckets[b].count > 0)
+        {
+            buckets[b].elements = new Data[pq.buckets[b].count];
+            buckets[b].count = buckets[b].capacity = pq.buckets[b].count;
+            std::copy(pq.buckets[b].elements, pq.buckets[b].elements + pq.buckets[b].count, buckets[b].elements);
+        }
+
+    occupied = pq.occupied;
+    last = pq.last;
+    size = pq.size;
+}
+
+// Move constructor
+template <typename Key, typename Value>
+PQRadix<Key, Value>::PQRadix(PQRadix &&pq) noexcept
+{
+    Swap(pq);
+}
+
+// Destructor
+template <typename Key, typename Value>
+PQRadix<Key, Value>::~PQRadix()
+{
+    Clear();
+}
+
+/* ---------------------------PQRadix: Assignments -------------------------- */
+
+// Copy assignment
+template <typename Key, typename Value>
+PQRadix<Key, Value> & PQRadix<Key, Value>::operator=(const PQRadix &pq)
+{
+    PQRadix<Key, Value> * tmp = new PQRadix<Key, Value>(pq);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Key, typename Value>
+PQRadix<Key, Value> & PQRadix<Key, Value>::operator=(PQRadix &&pq) noexcept
+{
+    Swap(pq);
+
+    return *this;
+}
+
+/* ---------------------------PQRadix: Comparison Operators-------------------------- */
+
+template <typename Key, typename Value>
+bool PQRadix<Key, Value>::operator==(const PQRadix &pq) const noexcept
+{
+    if(size != pq.size)
+        return false;
+
+    for(ulong b = 0; b <= Bits; b++)
+    {
+        if(buckets[b].count != pq.buckets[b].count)
+            return false;
+
+        if(!std::equal(buckets[b].elements, buckets[b].elements + buckets[b].count, pq.buckets[b].elements))
+            return false;
+    }
+
+    return true;
+}
+
+template <typename Key, typename Value>
+inline bool PQRadix<Key, Value>::operator!=(const PQRadix &pq) const noexcept
+{
+    return !((*this) == pq);
+}
+
+/* ---------------------------PQRadix: Specific member functions -------------------------- */
+
+template <typename Key, typename Value>
+inline Key PQRadix<Key, Value>::Last() const noexcept
+{
+    return last;
+}
+
+/* ---------------------------PQRadix: Specific member functions (inherited from PQ) -------------------------- */
+
+template <typename Key, typename Value>
+inline const typename PQRadix<Key, Value>::Data & PQRadix<Key, Value>::Tip() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQRadix is empty");
+
+    if(buckets[0].count > 0)
+        return buckets[0].elements[buckets[0].count - 1];
+
+    // Bucket 0 vuoto: la minima sta nel primo bucket non vuoto (Settle la porta nel bucket 0 solo alla rimozione)
+    const Bucket &bucket = buckets[std::countr_zero(occupied) + 1];
+
+    return *std::min_element(bucket.elements, bucket.elements + bucket.count, [] (const Data &fst, const Data &snd) { return fst.first < snd.first; });
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::RemoveTip()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQRadix is empty");
+
+    Settle();
+
+    buckets[0].count--;
+    size--;
+}
+
+template <typename Key, typename Value>
+typename PQRadix<Key, Value>::Data PQRadix<Key, Value>::TipNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: PQRadix is empty");
+
+    Settle();
+
+    buckets[0].count--;
+    size--;
+
+    return std::move(buckets[0].elements[buckets[0].count]);
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Insert(const Data &value)
+{
+    Add(value);
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Insert(Data &&value)
+{
+    Add(std::move(value));
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Change(ulong index, const Data &value)
+{
+    Update(index, value);
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Change(ulong index, Data &&value)
+{
+    Update(index, std::move(value));
+}
+
+/* ---------------------------PQRadix: Specific member function (inherited from LinearContainer) -------------------------- */
+
+template <typename Key, typename Value>
+const typename PQRadix<Key, Value>::Data & PQRadix<Key, Value>::operator[](ulong index) const
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from PQRadix");
+
+    ulong b, offset;
+    Locate(index, b, offset);
+
+    return buckets[b].elements[offset];
+}
+
+/* ---------------------------PQRadix: Specific member function (inherited from TraversableContainer) -------------------------- */
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Traverse(TraverseFun fun) const
+{
+    for(ulong b = 0; b <= Bits; b++)
+        for(ulong i = 0; i < buckets[b].count; i++)
+            fun(buckets[b].elements[i]);
+}
+
+/* ---------------------------PQRadix: Specific member function (inherited from ClearableContainer) -------------------------- */
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Clear()
+{
+    for(ulong b = 0; b <= Bits; b++)
+    {
+        delete[] buckets[b].elements;
+        buckets[b] = Bucket {};
+    }
+
+    occupied = 0;
+    last = 0;
+    size = 0;
+}
+
+/* ---------------------------PQRadix: Auxilary functions -------------------------- */
+
+// 0 se la chiave e' uguale all'ultima tolta, altrimenti 1 + il bit piu' alto in cui differisce
+template <typename Key, typename Value>
+inline ulong PQRadix<Key, Value>::BucketOf(Key key) const noexcept
+{
+    return static_cast<ulong>(std::bit_width(static_cast<Key>(key ^ last)));
+}
+
+template <typename Key, typename Value>
+template <typename Val>
+void PQRadix<Key, Value>::Append(ulong b, Val &&value)
+{
+    Bucket &bucket = buckets[b];
+
+    if(bucket.count == bucket.capacity)
+    {
+        ulong capacity = std::max(bucket.capacity * 2, 8UL);
+        Data * elements = new Data[capacity];
+
+        std::move(bucket.elements, bucket.elements + bucket.count, elements);
+        delete[] bucket.elements;
+
+        bucket.elements = elements;
+        bucket.capacity = capacity;
+    }
+
+    bucket.elements[bucket.count++] = std::forward<Val>(value);
+
+    if(b > 0)
+        occupied |= 1UL << (b - 1);
+}
+
+template <typename Key, typename Value>
+template <typename Val>
+void PQRadix<Key, Value>::Add(Val &&value)
+{
+    if(value.first < last)
+    {
+        if(size > 0)
+            throw std::out_of_range("Key Below The Last Tip from PQRadix");
+
+        last = value.first;
+    }
+
+    Append(BucketOf(value.first), std::forward<Val>(value));
+    size++;
+}
+
+template <typename Key, typename Value>
+template <typename Val>
+void PQRadix<Key, Value>::Update(ulong index, Val &&value)
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from PQRadix");
+
+    if(value.first < last)
+        throw std::out_of_range("Key Below The Last Tip from PQRadix");
+
+    ulong b, offset;
+    Locate(index, b, offset);
+
+    Bucket &bucket = buckets[b];
+
+    // Tolta dal suo bucket scambiandola con l'ultima, poi reinserita con la nuova chiave
+    if(offset != --bucket.count)
+        std::swap(bucket.elements[offset], bucket.elements[bucket.count]);
+
+    if(b > 0 && bucket.count == 0)
+        occupied &= ~(1UL << (b - 1));
+
+    Append(BucketOf(value.first), std::forward<Val>(value));
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Settle()
+{
+    if(buckets[0].count > 0)
+        return;
+
+    ulong b = static_cast<ulong>(std::countr_zero(occupied)) + 1;
+    Bucket &bucket = buckets[b];
+
+    Key min = bucket.elements[0].first;
+    for(ulong i = 1; i < bucket.count; i++)
+        min = std::min(min, bucket.elements[i].first);
+
+    // Rispetto alla nuova chiave minima ogni elemento del bucket finisce in un bucket piu' basso
+    last = min;
+
+    for(ulong i = 0; i < bucket.count; i++)
+        Append(BucketOf(bucket.elements[i].first), std::move(bucket.elements[i]));
+
+    bucket.count = 0;
+    occupied &= ~(1UL << (b - 1));
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Locate(ulong index, ulong &b, ulong &offset) const noexcept
+{
+    for(b = 0; index >= buckets[b].count; b++)
+        index -= buckets[b].count;
+
+    offset = index;
+}
+
+template <typename Key, typename Value>
+void PQRadix<Key, Value>::Swap(PQRadix &pq) noexcept
+{
+    for(ulong b = 0; b <= Bits; b++)
+        std::swap(buckets[b], pq.buckets[b]);
+
+    std::swap(occupied, pq.occupied);
+    std::swap(last, pq.last);
+    std::swap(size, pq.size);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,168 @@
+
+#ifndef PQRADIX_HPP
+#define PQRADIX_HPP
+
+/* ************************************************************************** */
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Radix heap: a monotone priority queue of (key, value) pairs with unsigned integer keys, the
+// smallest key in the tip. Keys inserted must not be below the key of the last tip removed (any
+// key is accepted while the queue is empty). Bucket i > 0 holds the keys whose highest bit
+// differing from that key is bit i - 1, bucket 0 the keys equal to it: Insert is O(1) and
+// RemoveTip moves each element at most once per bucket, O(log C) amortized for keys spanning a
+// range C. Positions follow the buckets; the order inside a bucket is arbitrary.
+
+template <typename Key, typename Value>
+class PQRadix : virtual public PQ<std::pair<Key, Value>> {
+  // Must extend PQ<std::pair<Key, Value>>
+
+  static_assert(std::is_unsigned_v<Key> && !std::is_same_v<Key, bool>, "PQRadix needs an unsigned integer key");
+
+public:
+
+  using Data = std::pair<Key, Value>;
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static constexpr ulong Bits = std::numeric_limits<Key>::digits;
+
+  struct Bucket {
+
+    // Data
+    Data * elements = nullptr;
+    ulong count = 0;
+    ulong capacity = 0;
+
+  };
+
+  Bucket buckets[Bits + 1];
+  ulong occupied = 0; // Bit i - 1 set when bucket i > 0 is not empty
+
+  Key last = 0; // Key of the last tip removed
+
+public:
+
+  // Default constructor
+  PQRadix() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQRadix(const TraversableContainer<Data> &); // A priority queue obtained from a TraversableContainer
+  PQRadix(MappableContainer<Data> &&); // A priority queue obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQRadix(const PQRadix &);
+
+  // Move constructor
+  PQRadix(PQRadix &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~PQRadix();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQRadix & operator=(const PQRadix &);
+
+  // Move assignment
+  PQRadix & operator=(PQRadix &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQRadix &) const noexcept; // (same pairs in the same positions)
+  inline bool operator!=(const PQRadix &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline Key Last() const noexcept; // Key of the last tip removed: the smallest key Insert accepts while the queue is not empty
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  inline const Data & Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data &) override; // Override PQ member (Copy of the value; must throw std::out_of_range when the key is below Last)
+  void Insert(Data &&) override; // Override PQ member (Move of the value; must throw std::out_of_range when the key is below Last)
+
+  void Change(ulong, const Data &) override; // Override PQ member (Copy of the value; must throw std::out_of_range when the key is below Last)
+  void Change(ulong, Data &&) override; // Override PQ member (Move of the value; must throw std::out_of_range when the key is below Last)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from LinearContainer)
+
+  const Data & operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Override TraversableContainer member (position order)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions
+
+  inline ulong BucketOf(Key) const noexcept;
+
+  template <typename Val>
+  void Append(ulong, Val &&); // Adds to a bucket, growing it when full
+
+  template <typename Val>
+  void Add(Val &&);
+
+  template <typename Val>
+  void Update(ulong, Val &&);
+
+  void Settle(); // Refills an empty bucket 0 from the first non-empty bucket (the queue must not be empty)
+
+  void Locate(ulong, ulong &, ulong &) const noexcept; // Bucket and offset of a position
+
+  void Swap(PQRadix &) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqradix.cpp"
+
+#endif
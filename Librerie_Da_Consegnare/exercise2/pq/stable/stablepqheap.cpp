@@ -0,0 +1,288 @@
+#include <algorithm>
+
+#include "stablepqheap.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------StablePQHeap: Constructors/Destructors -------------------------- */
+
+// A priority queue obtained from a TraversableContainer
+template <typename Data, ulong Arity, typename Compare>
+StablePQHeap<Data, Arity, Compare>::StablePQHeap(const TraversableContainer<Data> &cont)
+{
+    lasd::Vector<Entry> entries(cont.Size());
+    ulong index = 0;
+
+    cont.Traverse
+    (
+        [this, &entries, &index] (const Data &curr)
+        {
+            entries[index++] = Ticketed(curr);
+        }
+    );
+
+    heap.InsertAll(std::move(entries));
+    size = heap.Size();
+}
+
+// A priority queue obtained from a MappableContainer
+template <typename Data, ulong Arity, typename Compare>
+StablePQHeap<Data, Arity, Compare>::StablePQHeap(MappableContainer<Data> &&cont)
+{
+    lasd::Vector<Entry> entries(cont.Size());
+    ulong index = 0;
+
+    cont.Map
+    (
+        [this, &entries, &index] (Data &curr)
+        {
+            entries[index++] = Ticketed(std::move(curr));
+        }
+    );
+
+    heap.InsertAll(std::move(entries));
+    size = heap.Size();
+}
+
+// Copy constructor
+template <typename Data, ulong Arity, typename Compare>
+StablePQHeap<Data, Arity, Compare>::StablePQHeap(const StablePQHeap &pq) : heap(pq.heap), ticket(pq.ticket)
+{
+    size = pq.size;
+}
+
+// Move constructor
+template <typename Data, ulong Arity, typename Compare>
+StablePQHeap<Data, Arity, Compare>::StablePQHeap(StablePQHeap &&pq) noexcept : heap(std::move(pq.heap))
+{
+    std::swap(ticket, pq.ticket);
+    std::swap(size, pq.size);
+}
+
+/* ---------------------------StablePQHeap: Assignments -------------------------- */
+
+// Copy assignment
+template <typename Data, ulong Arity, typename Compare>
+StablePQHeap<Data, Arity, Compare> & StablePQHeap<Data, Arity, Compare>::operator=(const StablePQHeap &pq)
+{
+    StablePQHeap<Data, Arity, Compare> * tmp = new StablePQHeap<Data, Arity, Compare>(pq);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, ulong Arity, typename Compare>
+StablePQHeap<Data, Arity, Compare> & StablePQHeap<Data, Arity, Compare>::operator=(StablePQHeap &&pq) noexcept
+{
+    std::swap(heap, pq.heap);
+    std::swap(ticket, pq.ticket);
+    std::swap(size, pq.size);
+
+    return *this;
+}
+
+/* ---------------------------StablePQHeap: Comparison Operators-------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+bool StablePQHeap<Data, Arity, Compare>::operator==(const StablePQHeap &pq) const noexcept
+{
+    if(size != pq.size)
+        return false;
+
+    for(ulong i = 0; i < size; i++)
+        if(!(heap[i] == pq.heap[i]))
+            return false;
+
+    return true;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool StablePQHeap<Data, Arity, Compare>::operator!=(const StablePQHeap &pq) const noexcept
+{
+    return !((*this) == pq);
+}
+
+/* ---------------------------StablePQHeap: Specific member functions (inherited from PQ) -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+inline const Data & StablePQHeap<Data, Arity, Compare>::Tip() const
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: StablePQHeap is empty");
+
+    return Element(heap.Tip());
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::RemoveTip()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: StablePQHeap is empty");
+
+    heap.RemoveTip();
+    size--;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+Data StablePQHeap<Data, Arity, Compare>::TipNRemove()
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: StablePQHeap is empty");
+
+    Entry tip = heap.TipNRemove();
+    size--;
+
+    if constexpr(Natural)
+        return tip;
+    else
+        return std::move(tip.value);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::Insert(const Data &value)
+{
+    heap.Insert(Ticketed(value));
+    size++;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::Insert(Data &&value)
+{
+    heap.Insert(Ticketed(std::move(value)));
+    size++;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::Change(ulong index, const Data &value)
+{
+    Update(index, value);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::Change(ulong index, Data &&value)
+{
+    Update(index, std::move(value));
+}
+
+/* ---------------------------StablePQHeap: Specific member function (inherited from LinearContainer) -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+inline const Data & StablePQHeap<Data, Arity, Compare>::operator[](ulong index) const
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from StablePQHeap");
+
+    return Element(heap[index]);
+}
+
+/* ---------------------------StablePQHeap: Specific member function (inherited from ClearableContainer) -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::Clear()
+{
+    heap.Clear();
+    ticket = 0;
+    size = 0;
+}
+
+/* ---------------------------StablePQHeap: Auxilary functions -------------------------- */
+
+template <typename Data, ulong Arity, typename Compare>
+template <typename Value>
+typename StablePQHeap<Data, Arity, Compare>::Entry StablePQHeap<Data, Arity, Compare>::Ticketed(Value &&value)
+{
+    if constexpr(Natural)
+        return std::forward<Value>(value);
+    else if constexpr(Packed)
+    {
+        if(ticket > UINT32_MAX)
+            Renumber();
+
+        ulong key = PriorityBits(value) | static_cast<uint32_t>(~ticket++);
+
+        return Entry {key, std::forward<Value>(value)};
+    }
+    else
+        return Entry {std::forward<Value>(value), ticket++};
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline const Data & StablePQHeap<Data, Arity, Compare>::Element(const Entry &entry) noexcept
+{
+    if constexpr(Natural)
+        return entry;
+    else
+        return entry.value;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+template <typename Value>
+void StablePQHeap<Data, Arity, Compare>::Update(ulong index, Value &&value)
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from StablePQHeap");
+
+    if constexpr(Natural)
+        heap.Change(index, std::forward<Value>(value));
+    else
+    {
+        Entry entry = heap[index];
+
+        if constexpr(Packed)
+            entry.key = PriorityBits(value) | (entry.key & UINT32_MAX);
+
+        entry.value = std::forward<Value>(value);
+
+        heap.Change(index, std::move(entry));
+    }
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong StablePQHeap<Data, Arity, Compare>::PriorityBits(const Data &value) noexcept
+{
+    if constexpr(Packed)
+    {
+        // Con segno: il bit del segno invertito da' lo stesso ordine sugli interi senza segno
+        uint32_t priority = static_cast<uint32_t>(Compare::Key(value)) ^ (std::is_signed_v<decltype(Compare::Key(value))> ? 1U << 31 : 0);
+
+        return static_cast<ulong>(priority) << 32;
+    }
+    else
+        return 0;
+}
+
+// I ticket diventano 0, 1, ... nell'ordine di prima: tra due elementi ogni confronto da' lo
+// stesso esito, quindi Change non sposta nulla
+template <typename Data, ulong Arity, typename Compare>
+void StablePQHeap<Data, Arity, Compare>::Renumber()
+{
+    if constexpr(Packed)
+    {
+        ulong * order = new ulong[size];
+
+        for(ulong i = 0; i < size; i++)
+            order[i] = i;
+
+        std::sort(order, order + size, [this] (ulong fst, ulong snd) { return (heap[fst].key & UINT32_MAX) > (heap[snd].key & UINT32_MAX); });
+
+        for(ulong i = 0; i < size; i++)
+        {
+            Entry entry = heap[order[i]];
+            entry.key = (entry.key & ~static_cast<ulong>(UINT32_MAX)) | static_cast<uint32_t>(~i);
+            heap.Change(order[i], std::move(entry));
+        }
+
+        delete[] order;
+
+        ticket = size;
+    }
+}
+
+/* ************************************************************************** */
+
+}
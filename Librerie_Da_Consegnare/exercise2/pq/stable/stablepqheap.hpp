@@ -0,0 +1,184 @@
+
+#ifndef STABLEPQHEAP_HPP
+#define STABLEPQHEAP_HPP
+
+/* ************************************************************************** */
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../heap/pqheap.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// A PQHeap where equal priorities leave in insertion order (FIFO): every element carries the
+// ticket of its Insert, and Change keeps it. When the priority is the static Key of the comparator,
+// an integer of at most 32 bits (a before b exactly when Key(a) < Key(b)), priority and ticket are
+// packed into a 64-bit key computed once per Insert and Change, and every comparison is a single
+// integer comparison (tickets are renumbered, keeping their order, when the 32-bit counter runs
+// out). Otherwise the element is stored next to a 64-bit ticket that breaks the ties of Compare.
+// An integer ordered by std::less or std::greater is its own priority: equal elements cannot be
+// told apart, so it is kept in a plain PQHeap, without tickets and at its own size.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class StablePQHeap : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static constexpr bool Reversed = std::is_same_v<Compare, std::greater<Data>>;
+  static constexpr bool Natural = std::is_integral_v<Data> && (Reversed || std::is_same_v<Compare, std::less<Data>>);
+  static constexpr bool Packed = !Natural && requires (const Data &value) { { Compare::Key(value) } -> std::integral; requires sizeof(Compare::Key(value)) <= 4; };
+
+  struct PackedEntry {
+
+    // Data
+    ulong key = 0; // Priority in the high half, complement of the ticket (the older the greater) in the low half
+    Data value {};
+
+    bool operator==(const PackedEntry &) const noexcept = default;
+
+    inline bool operator<(const PackedEntry &entry) const noexcept { return key < entry.key; }
+    inline bool operator>(const PackedEntry &entry) const noexcept { return key > entry.key; }
+
+  };
+
+  struct WideEntry {
+
+    // Data
+    Data value {};
+    ulong ticket = 0;
+
+    bool operator==(const WideEntry &) const noexcept = default;
+
+    // Compare first, then the older ticket is the greater
+    inline bool operator<(const WideEntry &entry) const
+    {
+      if(Compare()(value, entry.value))
+        return true;
+      if(Compare()(entry.value, value))
+        return false;
+
+      return ticket > entry.ticket;
+    }
+
+    inline bool operator>(const WideEntry &entry) const { return entry < *this; }
+
+  };
+
+  using Entry = std::conditional_t<Natural, Data, std::conditional_t<Packed, PackedEntry, WideEntry>>;
+  using EntryCompare = std::conditional_t<Natural, Compare, std::less<Entry>>;
+
+  PQHeap<Entry, Arity, EntryCompare> heap;
+  ulong ticket = 0; // Ticket of the next Insert (unused when Natural)
+
+public:
+
+  // Default constructor
+  StablePQHeap() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  StablePQHeap(const TraversableContainer<Data> &); // A priority queue obtained from a TraversableContainer (tickets in traversal order)
+  StablePQHeap(MappableContainer<Data> &&); // A priority queue obtained from a MappableContainer (tickets in traversal order)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  StablePQHeap(const StablePQHeap &);
+
+  // Move constructor
+  StablePQHeap(StablePQHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~StablePQHeap() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  StablePQHeap & operator=(const StablePQHeap &);
+
+  // Move assignment
+  StablePQHeap & operator=(StablePQHeap &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const StablePQHeap &) const noexcept; // (same values with the same tickets, if any, in the same positions)
+  inline bool operator!=(const StablePQHeap &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  inline const Data & Tip() const override; // Override PQ member (the oldest among the greatest; must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data &) override; // Override PQ member (Copy of the value)
+  void Insert(Data &&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data &) override; // Override PQ member (Copy of the value; the ticket stays)
+  void Change(ulong, Data &&) override; // Override PQ member (Move of the value; the ticket stays)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from LinearContainer)
+
+  inline const Data & operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions
+
+  template <typename Value>
+  Entry Ticketed(Value &&); // The value with the next ticket (the value itself when Natural)
+
+  static inline const Data & Element(const Entry &) noexcept; // The element stored in an entry
+
+  template <typename Value>
+  void Update(ulong, Value &&);
+
+  static inline ulong PriorityBits(const Data &) noexcept; // The priority as an unsigned integer with the same order, in the high half
+
+  void Renumber(); // Tickets from 0 in the same order (packed entries only)
+
+};
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity = 2>
+using MinStablePQHeap = StablePQHeap<Data, Arity, std::greater<Data>>;
+
+/* ************************************************************************** */
+
+}
+
+#include "stablepqheap.cpp"
+
+#endif
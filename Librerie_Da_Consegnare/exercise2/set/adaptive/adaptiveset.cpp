@@ -0,0 +1,564 @@
+#include <algorithm>
+
+#include "adaptiveset.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------AdaptiveSet: Specific Constructors/Destructors-------------------------- */
+
+// Specific constructors
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity>::AdaptiveSet(ulong shrink, ulong freeze) // An empty set with the given shrink and freeze thresholds
+{
+    shrinkAt = std::min(shrink, InlineCapacity - 1); // Serve un margine fra i due passaggi, altrimenti oscilla
+    freezeAfter = freeze;
+}
+
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity>::AdaptiveSet(const TraversableContainer<Data> &cont) // A set obtained from a TraversableContainer
+{
+    cont.Traverse
+    (
+        [this] (const Data &curr)
+        {
+            Insert(curr);
+        }
+    );
+}
+
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity>::AdaptiveSet(MappableContainer<Data> &&cont) // A set obtained from a MappableContainer
+{
+    cont.Map
+    (
+        [this] (Data &curr)
+        {
+            Insert(std::move(curr));
+        }
+    );
+}
+
+// Copy constructor
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity>::AdaptiveSet(const AdaptiveSet &set) : Large(set.Large)
+{
+    size = set.size;
+    inlined = set.inlined;
+    shrinkAt = set.shrinkAt;
+    freezeAfter = set.freezeAfter;
+
+    for(ulong i = 0; i < InlineCapacity; i++)
+        Small[i] = set.Small[i];
+}
+
+// Move constructor
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity>::AdaptiveSet(AdaptiveSet &&set) noexcept
+{
+    std::swap(size, set.size);
+    std::swap(inlined, set.inlined);
+    std::swap(Small, set.Small);
+    std::swap(Large, set.Large);
+    Index.store(set.Index.exchange(nullptr));
+    reads.store(set.reads.exchange(0));
+    std::swap(shrinkAt, set.shrinkAt);
+    std::swap(freezeAfter, set.freezeAfter);
+}
+
+// Destructor
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity>::~AdaptiveSet()
+{
+    delete Index.load();
+}
+
+/* ---------------------------AdaptiveSet: Assignments-------------------------- */
+
+// Copy assignment
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity> & AdaptiveSet<Data, InlineCapacity>::operator=(const AdaptiveSet &set)
+{
+    AdaptiveSet<Data, InlineCapacity> * tmp = new AdaptiveSet<Data, InlineCapacity>(set);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, ulong InlineCapacity>
+AdaptiveSet<Data, InlineCapacity> & AdaptiveSet<Data, InlineCapacity>::operator=(AdaptiveSet &&set) noexcept
+{
+    std::swap(size, set.size);
+    std::swap(inlined, set.inlined);
+    std::swap(Small, set.Small);
+    std::swap(Large, set.Large);
+    Index.store(set.Index.exchange(Index.load()));
+    reads.store(set.reads.exchange(reads.load()));
+    std::swap(shrinkAt, set.shrinkAt);
+    std::swap(freezeAfter, set.freezeAfter);
+
+    return *this;
+}
+
+/* ---------------------------AdaptiveSet: Comparison Operators-------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+bool AdaptiveSet<Data, InlineCapacity>::operator==(const AdaptiveSet &set) const noexcept
+{
+    if(size != set.size)
+        return false;
+
+    for(ulong i = 0; i < size; i++)
+        if((*this)[i] != set[i])
+            return false;
+
+    return true;
+}
+
+template <typename Data, ulong InlineCapacity>
+inline bool AdaptiveSet<Data, InlineCapacity>::operator!=(const AdaptiveSet &set) const noexcept
+{
+    return !((*this) == set);
+}
+
+/* ---------------------------AdaptiveSet: Specific member functions------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+inline bool AdaptiveSet<Data, InlineCapacity>::Inlined() const noexcept
+{
+    return inlined;
+}
+
+template <typename Data, ulong InlineCapacity>
+inline bool AdaptiveSet<Data, InlineCapacity>::Indexed() const noexcept
+{
+    return (Index.load(std::memory_order_acquire) != nullptr);
+}
+
+/* ---------------------------AdaptiveSet: Specific member functions (inherited from OrderedDictionaryContainer)------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+const Data & AdaptiveSet<Data, InlineCapacity>::Min() const
+{
+    if(!inlined)
+        return Large.Min();
+
+    if(size == 0)
+        throw std::length_error("Empty Exception from AdaptiveSet");
+
+    return Small[0];
+}
+
+template <typename Data, ulong InlineCapacity>
+Data AdaptiveSet<Data, InlineCapacity>::MinNRemove()
+{
+    if(!inlined)
+    {
+        Data tmpMin = Large.MinNRemove();
+        Written();
+        return tmpMin;
+    }
+
+    if(size == 0)
+        throw std::length_error("Empty Exception from AdaptiveSet");
+
+    return SmallRemoveAt(0);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::RemoveMin()
+{
+    MinNRemove();
+}
+
+template <typename Data, ulong InlineCapacity>
+const Data & AdaptiveSet<Data, InlineCapacity>::Max() const
+{
+    if(!inlined)
+        return Large.Max();
+
+    if(size == 0)
+        throw std::length_error("Empty Exception from AdaptiveSet");
+
+    return Small[size - 1];
+}
+
+template <typename Data, ulong InlineCapacity>
+Data AdaptiveSet<Data, InlineCapacity>::MaxNRemove()
+{
+    if(!inlined)
+    {
+        Data tmpMax = Large.MaxNRemove();
+        Written();
+        return tmpMax;
+    }
+
+    if(size == 0)
+        throw std::length_error("Empty Exception from AdaptiveSet");
+
+    return SmallRemoveAt(size - 1);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::RemoveMax()
+{
+    MaxNRemove();
+}
+
+template <typename Data, ulong InlineCapacity>
+const Data & AdaptiveSet<Data, InlineCapacity>::Predecessor(const Data &key) const
+{
+    if(!inlined)
+    {
+        const FrozenSet<Data> * index = Lookup();
+        return index ? index->Predecessor(key) : Large.Predecessor(key);
+    }
+
+    ulong i = SmallLowerBound(key);
+
+    if(i == 0)
+        throw std::length_error("Predecessor Not Found from AdaptiveSet");
+
+    return Small[i - 1];
+}
+
+template <typename Data, ulong InlineCapacity>
+Data AdaptiveSet<Data, InlineCapacity>::PredecessorNRemove(const Data &key)
+{
+    if(!inlined)
+    {
+        Data tmpPred = Large.PredecessorNRemove(key);
+        Written();
+        return tmpPred;
+    }
+
+    ulong i = SmallLowerBound(key);
+
+    if(i == 0)
+        throw std::length_error("Predecessor Not Found from AdaptiveSet");
+
+    return SmallRemoveAt(i - 1);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::RemovePredecessor(const Data &key)
+{
+    PredecessorNRemove(key);
+}
+
+template <typename Data, ulong InlineCapacity>
+const Data & AdaptiveSet<Data, InlineCapacity>::Successor(const Data &key) const
+{
+    if(!inlined)
+    {
+        const FrozenSet<Data> * index = Lookup();
+        return index ? index->Successor(key) : Large.Successor(key);
+    }
+
+    ulong i = SmallUpperBound(key);
+
+    if(i == size)
+        throw std::length_error("Successor Not Found from AdaptiveSet");
+
+    return Small[i];
+}
+
+template <typename Data, ulong InlineCapacity>
+Data AdaptiveSet<Data, InlineCapacity>::SuccessorNRemove(const Data &key)
+{
+    if(!inlined)
+    {
+        Data tmpSucc = Large.SuccessorNRemove(key);
+        Written();
+        return tmpSucc;
+    }
+
+    ulong i = SmallUpperBound(key);
+
+    if(i == size)
+        throw std::length_error("Successor Not Found from AdaptiveSet");
+
+    return SmallRemoveAt(i);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::RemoveSuccessor(const Data &key)
+{
+    SuccessorNRemove(key);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::TraverseRange(const Data &first, const Data &last, RangeFun fun) const
+{
+    if(!inlined)
+        return Large.TraverseRange(first, last, fun);
+
+    for(ulong i = SmallLowerBound(first); i < size && !(Small[i] > last); i++)
+        fun(Small[i]);
+}
+
+template <typename Data, ulong InlineCapacity>
+ulong AdaptiveSet<Data, InlineCapacity>::CountRange(const Data &first, const Data &last) const
+{
+    if(!inlined)
+        return Large.CountRange(first, last);
+
+    ulong i = SmallLowerBound(first);
+    ulong j = SmallUpperBound(last);
+
+    return (j > i) ? j - i : 0;
+}
+
+template <typename Data, ulong InlineCapacity>
+ulong AdaptiveSet<Data, InlineCapacity>::RemoveRange(const Data &first, const Data &last)
+{
+    if(!inlined)
+    {
+        ulong removed = Large.RemoveRange(first, last);
+
+        if(removed > 0)
+            Written();
+
+        return removed;
+    }
+
+    ulong i = SmallLowerBound(first);
+    ulong j = SmallUpperBound(last);
+
+    if(j <= i)
+        return 0;
+
+    std::move(Small + j, Small + size, Small + i);
+    size -= j - i;
+
+    return j - i;
+}
+
+template <typename Data, ulong InlineCapacity>
+ulong AdaptiveSet<Data, InlineCapacity>::Rank(const Data &key) const
+{
+    return inlined ? SmallLowerBound(key) : Large.Rank(key);
+}
+
+template <typename Data, ulong InlineCapacity>
+const Data & AdaptiveSet<Data, InlineCapacity>::Select(ulong index) const
+{
+    if(!inlined)
+        return Large.Select(index);
+
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from AdaptiveSet");
+
+    return Small[index];
+}
+
+/* ---------------------------AdaptiveSet: Specific member functions (inherited from DictionaryContainer)------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+bool AdaptiveSet<Data, InlineCapacity>::Insert(const Data &key)
+{
+    return SmallInsert(key);
+}
+
+template <typename Data, ulong InlineCapacity>
+bool AdaptiveSet<Data, InlineCapacity>::Insert(Data &&key)
+{
+    return SmallInsert(std::move(key));
+}
+
+template <typename Data, ulong InlineCapacity>
+bool AdaptiveSet<Data, InlineCapacity>::Remove(const Data &key)
+{
+    if(!inlined)
+    {
+        if(!Large.Remove(key))
+            return false;
+
+        Written();
+        return true;
+    }
+
+    ulong i = SmallLowerBound(key);
+
+    if(i == size || Small[i] != key)
+        return false;
+
+    SmallRemoveAt(i);
+    return true;
+}
+
+/* ---------------------------AdaptiveSet: Specific member functions (inherited from LinearContainer)------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+const Data & AdaptiveSet<Data, InlineCapacity>::operator[](const ulong index) const
+{
+    if(!inlined)
+        return Large[index];
+
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from LinearContainer(AdaptiveSet)");
+
+    return Small[index];
+}
+
+/* ---------------------------AdaptiveSet: Specific member functions (inherited from TestableContainer)------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+bool AdaptiveSet<Data, InlineCapacity>::Exists(const Data &key) const noexcept
+{
+    if(!inlined)
+    {
+        const FrozenSet<Data> * index = Lookup();
+        return index ? index->Exists(key) : Large.Exists(key);
+    }
+
+    ulong i = SmallLowerBound(key);
+
+    return (i != size && Small[i] == key);
+}
+
+/* ---------------------------AdaptiveSet: Specific member functions (inherited from ClearableContainer)------------------------- */
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::Clear()
+{
+    delete Index.exchange(nullptr);
+    reads.store(0);
+
+    Large.Clear();
+    inlined = true;
+    size = 0;
+}
+
+/* ---------------------------AdaptiveSet: Protected auxilary functions------------------------- */
+
+// Con pochi elementi la scansione lineare batte la ricerca binaria (niente salti imprevedibili)
+
+template <typename Data, ulong InlineCapacity>
+inline ulong AdaptiveSet<Data, InlineCapacity>::SmallLowerBound(const Data &key) const noexcept
+{
+    ulong i = 0;
+
+    while(i < size && Small[i] < key)
+        i++;
+
+    return i;
+}
+
+template <typename Data, ulong InlineCapacity>
+inline ulong AdaptiveSet<Data, InlineCapacity>::SmallUpperBound(const Data &key) const noexcept
+{
+    ulong i = 0;
+
+    while(i < size && !(Small[i] > key))
+        i++;
+
+    return i;
+}
+
+template <typename Data, ulong InlineCapacity>
+template <typename Value>
+bool AdaptiveSet<Data, InlineCapacity>::SmallInsert(Value &&key)
+{
+    if(!inlined)
+    {
+        if(!Large.Insert(std::forward<Value>(key)))
+            return false;
+
+        Written();
+        return true;
+    }
+
+    ulong i = SmallLowerBound(key);
+
+    if(i != size && Small[i] == key)
+        return false;
+
+    if(size == InlineCapacity)
+    {
+        Promote();
+        return SmallInsert(std::forward<Value>(key));
+    }
+
+    std::move_backward(Small + i, Small + size, Small + size + 1);
+    Small[i] = std::forward<Value>(key);
+    size++;
+
+    return true;
+}
+
+template <typename Data, ulong InlineCapacity>
+Data AdaptiveSet<Data, InlineCapacity>::SmallRemoveAt(ulong index)
+{
+    Data tmp = std::move(Small[index]);
+
+    std::move(Small + index + 1, Small + size, Small + index);
+    size--;
+
+    return tmp;
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::Promote()
+{
+    for(ulong i = 0; i < size; i++)
+        Large.Insert(std::move(Small[i])); // In coda: gia' ordinati
+
+    inlined = false;
+    reads.store(0);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::Demote()
+{
+    ulong i = 0;
+
+    while(!Large.Empty())
+        Small[i++] = Large.MinNRemove();
+
+    size = i;
+    inlined = true;
+}
+
+// La copia costa O(n): si costruisce solo dopo una fase di sole letture lunga almeno n / 16.
+// fetch_add da' a ogni lettura un numero diverso, quindi una sola lettura (anche fra piu' thread)
+// vede esattamente la soglia e costruisce l'indice; le altre intanto cercano su Large
+template <typename Data, ulong InlineCapacity>
+const FrozenSet<Data> * AdaptiveSet<Data, InlineCapacity>::Lookup() const noexcept
+{
+    ulong count = reads.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if(count == std::max({freezeAfter, size / 16, 1UL}))
+    {
+        try
+        {
+            Index.store(new FrozenSet<Data>(Large), std::memory_order_release);
+        }
+        catch(...)
+        {
+            // Senza indice si continua a cercare su Large (fino alla prossima scrittura)
+        }
+    }
+
+    return Index.load(std::memory_order_acquire);
+}
+
+template <typename Data, ulong InlineCapacity>
+void AdaptiveSet<Data, InlineCapacity>::Written()
+{
+    delete Index.exchange(nullptr);
+    reads.store(0);
+
+    size = Large.Size();
+
+    if(size <= shrinkAt)
+        Demote();
+}
+
+/* ************************************************************************** */
+
+}
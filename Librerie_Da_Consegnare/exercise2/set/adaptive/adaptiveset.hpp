@@ -0,0 +1,171 @@
+
+#ifndef ADAPTIVESET_HPP
+#define ADAPTIVESET_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+#include "../vec/setvec.hpp"
+#include "../frozen/frozenset.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data, ulong InlineCapacity = 16>
+class AdaptiveSet : virtual public Set<Data>{
+  // Must extend Set<Data>
+  // Small sets live in an inline sorted array (linear search), larger ones in a SetVec;
+  // a FrozenSet index is added to the SetVec during long read-only phases.
+  // Const lookups may run concurrently (as long as nothing writes): the lookup counter is atomic
+  // and the index is built once, by the lookup that reaches the threshold, then published
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  bool inlined = true; // Which layout holds the keys
+
+  Data Small[InlineCapacity] {}; // Inline layout: sorted, Small[0 .. size)
+  SetVec<Data> Large; // Sorted array layout
+
+  mutable std::atomic<FrozenSet<Data> *> Index {nullptr}; // Read-optimized snapshot of Large (only when inlined is false)
+  mutable std::atomic<ulong> reads {0}; // Lookups since the last write
+
+  ulong shrinkAt = InlineCapacity / 2; // Back to the inline layout at this size (hysteresis)
+  ulong freezeAfter = 256; // Minimum number of consecutive lookups before building Index
+
+public:
+
+  // Default constructor
+  AdaptiveSet() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  AdaptiveSet(ulong, ulong); // An empty set with the given shrink and freeze thresholds
+  AdaptiveSet(const TraversableContainer<Data> &); // A set obtained from a TraversableContainer
+  AdaptiveSet(MappableContainer<Data> &&); // A set obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  AdaptiveSet(const AdaptiveSet &);
+
+  // Move constructor
+  AdaptiveSet(AdaptiveSet &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~AdaptiveSet();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  AdaptiveSet & operator=(const AdaptiveSet &);
+
+  // Move assignment
+  AdaptiveSet & operator=(AdaptiveSet &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const AdaptiveSet &) const noexcept;
+  inline bool operator!=(const AdaptiveSet &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  inline bool Inlined() const noexcept; // True while the keys are in the inline array
+  inline bool Indexed() const noexcept; // True while the FrozenSet index is available
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data & Min() const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  Data MinNRemove() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  void RemoveMin() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+
+  const Data & Max() const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  Data MaxNRemove() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  void RemoveMax() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+
+  const Data & Predecessor(const Data &) const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  Data PredecessorNRemove(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  void RemovePredecessor(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+
+  const Data & Successor(const Data &) const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  Data SuccessorNRemove(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  void RemoveSuccessor(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  void TraverseRange(const Data &, const Data &, RangeFun) const override; // Override OrderedDictionaryContainer member
+  ulong CountRange(const Data &, const Data &) const override; // Override OrderedDictionaryContainer member
+  ulong RemoveRange(const Data &, const Data &) override; // Override OrderedDictionaryContainer member
+
+  ulong Rank(const Data &) const override; // Override OrderedDictionaryContainer member
+  const Data & Select(ulong) const override; // Override OrderedDictionaryContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data &) override; // Override DictionaryContainer member (copy of the value)
+  bool Insert(Data &&) override; // Override DictionaryContainer member (move of the value)
+  bool Remove(const Data &) override; // Override DictionaryContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data & operator[](const ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************** */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data &) const noexcept override; // Override TestableContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override; // Override ClearableContainer member
+
+protected:
+
+  inline ulong SmallLowerBound(const Data &) const noexcept; // First inline position with key >= the given one
+  inline ulong SmallUpperBound(const Data &) const noexcept; // First inline position with key > the given one
+
+  template <typename Value>
+  bool SmallInsert(Value &&);
+  Data SmallRemoveAt(ulong);
+
+  void Promote(); // Inline array -> SetVec
+  void Demote(); // SetVec -> inline array
+
+  const FrozenSet<Data> * Lookup() const noexcept; // Accounting of a lookup on Large (may build Index), returns Index or nullptr
+  void Written(); // Accounting of a write on Large (drops Index, may demote)
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "adaptiveset.cpp"
+
+#endif
@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <bit>
+
+#include "frozenset.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------FrozenSet: Specific Constructors/Destructors-------------------------- */
+
+// Specific constructor
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare>::FrozenSet(const Set<Data> &set) // A snapshot of the given set
+{
+    size = set.Size();
+    Elements = new Data[size + 1] {};
+
+    // La visita in ordine dell'albero implicito coincide con l'ordine crescente del set, se il set
+    // usa lo stesso ordine: lo si controlla strada facendo, un confronto per chiave
+    ulong k = First(1);
+    ulong prev = 0;
+    bool ordered = true;
+
+    set.Traverse
+    (
+        [this, &k, &prev, &ordered] (const Data &curr)
+        {
+            Elements[k] = curr;
+
+            if(prev != 0 && !compare(Elements[prev], Elements[k]))
+                ordered = false;
+
+            prev = k;
+            k = Next(k);
+        }
+    );
+
+    if(!ordered)
+        Reorder();
+}
+
+// Copy constructor
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare>::FrozenSet(const FrozenSet &set)
+{
+    size = set.size;
+    Elements = new Data[size + 1] {};
+
+    for(ulong k = 1; k <= size; k++)
+        Elements[k] = set.Elements[k];
+}
+
+// Move constructor
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare>::FrozenSet(FrozenSet &&set) noexcept
+{
+    std::swap(Elements, set.Elements);
+    std::swap(size, set.size);
+}
+
+// Destructor
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare>::~FrozenSet()
+{
+    delete[] Elements;
+}
+
+/* ---------------------------FrozenSet: Assignments-------------------------- */
+
+// Copy assignment
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare> & FrozenSet<Data, Compare>::operator=(const FrozenSet &set)
+{
+    FrozenSet<Data, Compare> * tmp = new FrozenSet<Data, Compare>(set);
+
+    std::swap(*tmp, *this);
+    delete tmp;
+
+    return *this;
+}
+
+// Move assignment
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare> & FrozenSet<Data, Compare>::operator=(FrozenSet &&set) noexcept
+{
+    std::swap(Elements, set.Elements);
+    std::swap(size, set.size);
+
+    return *this;
+}
+
+/* ---------------------------FrozenSet: Comparison Operators-------------------------- */
+
+template <typename Data, typename Compare>
+bool FrozenSet<Data, Compare>::operator==(const FrozenSet &set) const noexcept
+{
+    if(size != set.size)
+        return false;
+
+    // Stessa dimensione => stessa forma dell'albero
+    for(ulong k = 1; k <= size; k++)
+        if(Elements[k] != set.Elements[k])
+            return false;
+
+    return true;
+}
+
+template <typename Data, typename Compare>
+inline bool FrozenSet<Data, Compare>::operator!=(const FrozenSet &set) const noexcept
+{
+    return !((*this) == set);
+}
+
+/* ---------------------------FrozenSet: Specific member functions------------------------- */
+
+template <typename Data, typename Compare>
+const Data & FrozenSet<Data, Compare>::Min() const
+{
+    if(size == 0)
+        throw std::length_error("Empty Exception from FrozenSet\n");
+
+    return Elements[First(1)];
+}
+
+template <typename Data, typename Compare>
+const Data & FrozenSet<Data, Compare>::Max() const
+{
+    if(size == 0)
+        throw std::length_error("Empty Exception from FrozenSet\n");
+
+    ulong k = 1;
+    while(2 * k + 1 <= size)
+        k = 2 * k + 1;
+
+    return Elements[k];
+}
+
+// La discesa codifica il cammino nei bit di k (1 = destra): l'ultimo nodo in cui
+// si e' girato a destra e' il predecessore, l'ultimo in cui si e' girato a sinistra il successore
+
+template <typename Data, typename Compare>
+const Data & FrozenSet<Data, Compare>::Predecessor(const Data &key) const
+{
+    ulong k = Descend([this, &key] (const Data &curr) { return compare(curr, key); });
+
+    k >>= std::countr_zero(k) + 1;
+
+    if(k == 0)
+        throw std::length_error("Predecessor Not Found from FrozenSet");
+
+    return Elements[k];
+}
+
+template <typename Data, typename Compare>
+const Data & FrozenSet<Data, Compare>::Successor(const Data &key) const
+{
+    ulong k = Descend([this, &key] (const Data &curr) { return !compare(key, curr); });
+
+    k >>= std::countr_one(k) + 1;
+
+    if(k == 0)
+        throw std::length_error("Successor Not Found from FrozenSet");
+
+    return Elements[k];
+}
+
+/* ---------------------------FrozenSet: Specific member functions (inherited from TraversableContainer)------------------------- */
+
+template <typename Data, typename Compare>
+void FrozenSet<Data, Compare>::Traverse(TraverseFun fun) const
+{
+    if(size == 0)
+        return;
+
+    for(ulong k = First(1); k != 0; k = Next(k))
+        fun(Elements[k]);
+}
+
+/* ---------------------------FrozenSet: Specific member functions (inherited from TestableContainer)------------------------- */
+
+template <typename Data, typename Compare>
+bool FrozenSet<Data, Compare>::Exists(const Data &key) const noexcept
+{
+    ulong k = Descend([this, &key] (const Data &curr) { return compare(curr, key); });
+
+    k >>= std::countr_one(k) + 1; // Primo elemento >= key
+
+    return (k != 0 && !compare(key, Elements[k]));
+}
+
+/* ---------------------------FrozenSet: Protected auxilary functions------------------------- */
+
+template <typename Data, typename Compare>
+template <typename Pred>
+inline ulong FrozenSet<Data, Compare>::Descend(Pred pred) const noexcept
+{
+    ulong k = 1;
+
+    while(k <= size)
+    {
+        // Quattro livelli piu' in basso: 16 nodi contigui, una o due linee di cache
+        if(16 * k <= size)
+            __builtin_prefetch(Elements + 16 * k);
+
+        k = 2 * k + static_cast<ulong>(pred(Elements[k]));
+    }
+
+    return k;
+}
+
+template <typename Data, typename Compare>
+inline ulong FrozenSet<Data, Compare>::First(ulong k) const noexcept
+{
+    while(2 * k <= size)
+        k = 2 * k;
+
+    return k;
+}
+
+template <typename Data, typename Compare>
+inline ulong FrozenSet<Data, Compare>::Next(ulong k) const noexcept
+{
+    if(2 * k + 1 <= size)
+        return First(2 * k + 1);
+
+    // Risalgo finche' sono figlio destro, poi il padre e' il successore
+    k >>= std::countr_one(k) + 1;
+
+    return k;
+}
+
+// Set con un altro ordine (Set<Data> non porta il suo comparatore nel tipo): le chiavi si
+// riordinano secondo compare, una sola per classe di equivalenza (la prima visitata), e si
+// ridispongono nell'albero implicito
+template <typename Data, typename Compare>
+void FrozenSet<Data, Compare>::Reorder()
+{
+    Data * keys = new Data[size];
+    Data * tree;
+
+    try
+    {
+        tree = new Data[size + 1] {};
+    }
+    catch(...)
+    {
+        delete[] keys;
+        throw;
+    }
+
+    ulong count = 0;
+
+    for(ulong k = First(1); k != 0; k = Next(k))
+        keys[count++] = std::move(Elements[k]);
+
+    std::stable_sort(keys, keys + count, compare);
+    count = std::unique(keys, keys + count, [this] (const Data &fst, const Data &snd) { return !compare(fst, snd) && !compare(snd, fst); }) - keys;
+
+    delete[] Elements;
+    Elements = tree;
+    size = count;
+
+    ulong k = First(1);
+
+    for(ulong i = 0; i < count; i++, k = Next(k))
+        Elements[k] = std::move(keys[i]);
+
+    delete[] keys;
+}
+
+/* ************************************************************************** */
+
+}
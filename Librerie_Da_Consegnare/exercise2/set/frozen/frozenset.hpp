@@ -0,0 +1,115 @@
+
+#ifndef FROZENSET_HPP
+#define FROZENSET_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare = std::less<Data>>
+class FrozenSet : virtual public TraversableContainer<Data>{
+  // Must extend TraversableContainer<Data>
+  // Read-only snapshot of a Set: the keys are stored in Eytzinger (BFS) order
+  // (a source set traversed in another order is re-sorted by Compare, one key per equivalence class)
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  Data * Elements = nullptr; // 1-based implicit search tree: the children of k are 2k and 2k + 1 (Elements[0] unused)
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
+public:
+
+  // Default constructor
+  FrozenSet() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructor
+  FrozenSet(const Set<Data> &); // A snapshot of the given set
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  FrozenSet(const FrozenSet &);
+
+  // Move constructor
+  FrozenSet(FrozenSet &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~FrozenSet();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FrozenSet & operator=(const FrozenSet &);
+
+  // Move assignment
+  FrozenSet & operator=(FrozenSet &&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const FrozenSet &) const noexcept;
+  inline bool operator!=(const FrozenSet &) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const Data & Min() const; // (must throw std::length_error when empty)
+  const Data & Max() const; // (must throw std::length_error when empty)
+
+  const Data & Predecessor(const Data &) const; // (must throw std::length_error when not found)
+  const Data & Successor(const Data &) const; // (must throw std::length_error when not found)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Override TraversableContainer member (keys in ascending order)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data &) const noexcept override; // Override TestableContainer member
+
+protected:
+
+  template <typename Pred>
+  inline ulong Descend(Pred) const noexcept; // Leaf position reached going right while the predicate holds
+
+  inline ulong First(ulong) const noexcept; // Leftmost node of a subtree
+  inline ulong Next(ulong) const noexcept; // In-order successor of a node (0 when none)
+
+  void Reorder(); // Sorts the keys by Compare when the source set used another order
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "frozenset.cpp"
+
+#endif
@@ -7,8 +7,8 @@ namespace lasd {
 /* ---------------------------SetLst: Specific Constructors/Destructors-------------------------- */
 
 // Specific constructors
-template <typename Data>
-SetLst<Data>::SetLst(const TraversableContainer<Data> &cont) // A set obtained from a TraversableContainer
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(const TraversableContainer<Data> &cont) // A set obtained from a TraversableContainer
 {
     cont.Traverse
     (
@@ -19,8 +19,8 @@ SetLst<Data>::SetLst(const TraversableContainer<Data> &cont) // A set obtained f
     );
 }
 
-template <typename Data>
-SetLst<Data>::SetLst(MappableContainer<Data> &&cont) // A set obtained from a MappableContainer non mette noexcept? 
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(MappableContainer<Data> &&cont) // A set obtained from a MappableContainer non mette noexcept? 
 {
     cont.Map
     (
@@ -32,12 +32,12 @@ SetLst<Data>::SetLst(MappableContainer<Data> &&cont) // A set obtained from a Ma
 }
 
 // Copy constructor
-template <typename Data>
-SetLst<Data>::SetLst(const SetLst &lst) : List<Data>::List(lst) {}
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(const SetLst &lst) : List<Data>::List(lst) {}
 
 // Move constructor
-template <typename Data>
-SetLst<Data>::SetLst(SetLst &&lst) noexcept
+template <typename Data, typename Compare>
+SetLst<Data, Compare>::SetLst(SetLst &&lst) noexcept
 {
     std::swap(this->head, lst.head);
     std::swap(this->tail, lst.tail);
@@ -47,16 +47,16 @@ SetLst<Data>::SetLst(SetLst &&lst) noexcept
 /* ---------------------------SetLst: Assignments-------------------------- */
 
 // Copy assignment
-template <typename Data>
-SetLst<Data> & SetLst<Data>::operator=(const SetLst &lst)
+template <typename Data, typename Compare>
+SetLst<Data, Compare> & SetLst<Data, Compare>::operator=(const SetLst &lst)
 {
     List<Data>::operator=(lst);
     return *this;
 }
 
 // Move assignment
-template <typename Data>
-SetLst<Data> & SetLst<Data>::operator=(SetLst &&lst) noexcept
+template <typename Data, typename Compare>
+SetLst<Data, Compare> & SetLst<Data, Compare>::operator=(SetLst &&lst) noexcept
 {
     std::swap(this->head, lst.head);
     std::swap(this->tail, lst.tail);
@@ -67,22 +67,22 @@ SetLst<Data> & SetLst<Data>::operator=(SetLst &&lst) noexcept
 
 /* ---------------------------SetLst: Comparison Operators-------------------------- */
 
-template <typename Data>
-bool SetLst<Data>::operator==(const SetLst &lst) const noexcept
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::operator==(const SetLst &lst) const noexcept
 {
     return List<Data>::operator==(lst);
 }
 
-template <typename Data>
-inline bool SetLst<Data>::operator!=(const SetLst &lst) const noexcept
+template <typename Data, typename Compare>
+inline bool SetLst<Data, Compare>::operator!=(const SetLst &lst) const noexcept
 {
     return !((*this) == lst);
 }
 
 /* ---------------------------SetLst: Specific member functions (inherited from OrderedDictionaryContainer)------------------------- */
 
-template <typename Data>
-const Data & SetLst<Data>::Min() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+const Data & SetLst<Data, Compare>::Min() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(!head)
         throw std::length_error("Empty Exception from SetList");
@@ -90,8 +90,8 @@ const Data & SetLst<Data>::Min() const // Override OrderedDictionaryContainer me
     return head->elem;
 }
 
-template <typename Data>
-Data SetLst<Data>::MinNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::MinNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(!head)
         throw std::length_error("Empty Exception from SetList");
@@ -102,8 +102,8 @@ Data SetLst<Data>::MinNRemove() // Override OrderedDictionaryContainer member (c
     return tmpMin;
 }
 
-template <typename Data>
-void SetLst<Data>::RemoveMin() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemoveMin() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(!head)
         throw std::length_error("Empty Exception from SetList");
@@ -111,8 +111,8 @@ void SetLst<Data>::RemoveMin() // Override OrderedDictionaryContainer member (co
     List<Data>::RemoveFromFront();
 }
 
-template <typename Data>
-const Data & SetLst<Data>::Max() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+const Data & SetLst<Data, Compare>::Max() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(!head)
         throw std::length_error("Empty Exception from SetList");
@@ -120,8 +120,8 @@ const Data & SetLst<Data>::Max() const // Override OrderedDictionaryContainer me
     return tail->elem;
 }
 
-template <typename Data>
-Data SetLst<Data>::MaxNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::MaxNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(!head)
         throw std::length_error("Empty Exception from SetList");
@@ -133,8 +133,8 @@ Data SetLst<Data>::MaxNRemove() // Override OrderedDictionaryContainer member (c
     return tmpMax;
 }
 
-template <typename Data>
-void SetLst<Data>::RemoveMax() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemoveMax() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(!head)
         throw std::length_error("Empty Exception from SetList");
@@ -142,8 +142,8 @@ void SetLst<Data>::RemoveMax() // Override OrderedDictionaryContainer member (co
     List<Data>::RemoveFromBack();
 }
 
-template <typename Data>
-const Data & SetLst<Data>::Predecessor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+const Data & SetLst<Data, Compare>::Predecessor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     bool check = false;
     Node * pred = BSearchPred(key, &check);
@@ -154,8 +154,8 @@ const Data & SetLst<Data>::Predecessor(const Data &key) const // Override Ordere
     return pred->elem;
 }
 
-template <typename Data>
-Data SetLst<Data>::PredecessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::PredecessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     if(!size)
         throw std::length_error("Predecessor not found: SetLst");
@@ -183,7 +183,7 @@ Data SetLst<Data>::PredecessorNRemove(const Data &key) // Override OrderedDictio
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem < key)
+       if(compare(walk_ptr->elem, key))
        {
             pred = pre_reminder = walk_ptr;
             pre_pred = pre_walk_ptr;
@@ -219,8 +219,8 @@ Data SetLst<Data>::PredecessorNRemove(const Data &key) // Override OrderedDictio
     return tmpPred;
 }
 
-template <typename Data>
-void SetLst<Data>::RemovePredecessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemovePredecessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     if(!size)
         throw std::length_error("Predecessor not found: SetLst");
@@ -247,7 +247,7 @@ void SetLst<Data>::RemovePredecessor(const Data &key) // Override OrderedDiction
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem < key)
+       if(compare(walk_ptr->elem, key))
        {
             pred = pre_reminder = walk_ptr;
             pre_pred = pre_walk_ptr;
@@ -280,8 +280,8 @@ void SetLst<Data>::RemovePredecessor(const Data &key) // Override OrderedDiction
 
 }
 
-template <typename Data>
-const Data & SetLst<Data>::Successor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+const Data & SetLst<Data, Compare>::Successor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     bool check = false;
     Node * succ = BSearchSucc(key, &check);
@@ -292,8 +292,8 @@ const Data & SetLst<Data>::Successor(const Data &key) const // Override OrderedD
     return succ->elem;
 }
 
-template <typename Data>
-Data SetLst<Data>::SuccessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+Data SetLst<Data, Compare>::SuccessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     if(!size)
         throw std::length_error("Successor not found: SetLst");
@@ -320,7 +320,7 @@ Data SetLst<Data>::SuccessorNRemove(const Data &key) // Override OrderedDictiona
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem > key)
+       if(compare(key, walk_ptr->elem))
        {
             succ = walk_ptr;
             pre_succ = pre_walk_ptr;
@@ -356,8 +356,8 @@ Data SetLst<Data>::SuccessorNRemove(const Data &key) // Override OrderedDictiona
     return tmpSucc;
 }
 
-template <typename Data>
-void SetLst<Data>::RemoveSuccessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::RemoveSuccessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     if(!size)
         throw std::length_error("Predecessor not found: SetLst");
@@ -384,7 +384,7 @@ void SetLst<Data>::RemoveSuccessor(const Data &key) // Override OrderedDictionar
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem > key)
+       if(compare(key, walk_ptr->elem))
        {
             succ = walk_ptr;
             pre_succ = pre_walk_ptr;
@@ -416,10 +416,103 @@ void SetLst<Data>::RemoveSuccessor(const Data &key) // Override OrderedDictionar
         size--;
     }
 }
+
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::TraverseRange(const Data &first, const Data &last, RangeFun fun) const
+{
+    bool check = false;
+    Node * before = BSearchPred(first, &check);
+
+    for(Node * curr = (before ? before->next : head); curr && !(compare(last, curr->elem)); curr = curr->next)
+        fun(curr->elem);
+}
+
+template <typename Data, typename Compare>
+ulong SetLst<Data, Compare>::CountRange(const Data &first, const Data &last) const
+{
+    ulong count = 0;
+
+    TraverseRange(first, last, [&count] (const Data &) { count++; });
+
+    return count;
+}
+
+template <typename Data, typename Compare>
+ulong SetLst<Data, Compare>::RemoveRange(const Data &first, const Data &last)
+{
+    bool check = false;
+    Node * before = BSearchPred(first, &check);
+    Node * begin = before ? before->next : head;
+    Node * end = nullptr;
+    ulong removed = 0;
+
+    for(Node * curr = begin; curr && !(compare(last, curr->elem)); curr = curr->next)
+    {
+        end = curr;
+        removed++;
+    }
+
+    if(removed == 0)
+        return 0;
+
+    // Stacco la catena [begin, end] con un solo aggiornamento dei puntatori
+    if(before)
+        before->next = end->next;
+    else
+        head = end->next;
+
+    if(!end->next)
+        tail = before;
+
+    end->next = nullptr;
+    size -= removed;
+
+    // Cancellazione iterativa: il distruttore di Node e' ricorsivo
+    while(begin)
+    {
+        Node * next = begin->next;
+        begin->next = nullptr;
+        delete begin;
+        begin = next;
+    }
+
+    return removed;
+}
+
+// Su una lista la ricerca "binaria" percorre comunque ~n nodi: una scansione che si ferma prima costa meno
+
+template <typename Data, typename Compare>
+ulong SetLst<Data, Compare>::Rank(const Data &key) const
+{
+    ulong rank = 0;
+
+    for(Node * curr = head; curr && compare(curr->elem, key); curr = curr->next)
+        rank++;
+
+    return rank;
+}
+
+template <typename Data, typename Compare>
+const Data & SetLst<Data, Compare>::Select(ulong index) const
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from SetLst");
+
+    if(index == size - 1)
+        return tail->elem;
+
+    Node * curr = head;
+
+    for(ulong i = 0; i < index; i++)
+        curr = curr->next;
+
+    return curr->elem;
+}
+
 /* ---------------------------SetLst: Specific member functions (inherited from DictionaryContainer)------------------------- */
 
-template <typename Data>
-bool SetLst<Data>::Insert(const Data &key) // Override DictionaryContainer member (copy of the value)
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Insert(const Data &key) // Override DictionaryContainer member (copy of the value)
 {
     if(size == 0)
         List<Data>::InsertAtFront(key);
@@ -451,8 +544,8 @@ bool SetLst<Data>::Insert(const Data &key) // Override DictionaryContainer membe
     return true;
 }
 
-template <typename Data>
-bool SetLst<Data>::Insert(Data &&key) // Override DictionaryContainer member (move of the value)
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Insert(Data &&key) // Override DictionaryContainer member (move of the value)
 {
     if(size == 0)
         List<Data>::InsertAtFront(key);
@@ -484,8 +577,8 @@ bool SetLst<Data>::Insert(Data &&key) // Override DictionaryContainer member (mo
     return true;
 }
 
-template <typename Data>
-bool SetLst<Data>::Remove(const Data &key) // Override DictionaryContainer member
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Remove(const Data &key) // Override DictionaryContainer member
 {
     if(size != 0)
     {
@@ -517,16 +610,16 @@ bool SetLst<Data>::Remove(const Data &key) // Override DictionaryContainer membe
 
 /* ---------------------------SetLst: Specific member functions (inherited from LinearContainer)------------------------- */
 
-template <typename Data>
-const Data & SetLst<Data>::operator[](const ulong index) const
+template <typename Data, typename Compare>
+const Data & SetLst<Data, Compare>::operator[](const ulong index) const
 {
     return List<Data>::operator[](index);
 }
 
 /* ---------------------------SetLst: Specific member functions (inherited from TestableContainer)------------------------- */
 
-template <typename Data>
-bool SetLst<Data>::Exists(const Data &key) const noexcept
+template <typename Data, typename Compare>
+bool SetLst<Data, Compare>::Exists(const Data &key) const noexcept
 {
     bool check = false;
 
@@ -537,16 +630,16 @@ bool SetLst<Data>::Exists(const Data &key) const noexcept
 
 /* ---------------------------SetLst: Specific member functions (inherited from ClearableContainer)------------------------- */
 
-template <typename Data>
-void SetLst<Data>::Clear()
+template <typename Data, typename Compare>
+void SetLst<Data, Compare>::Clear()
 {
     List<Data>::Clear();
 }
 
 /* ---------------------------SetLst: Protected auxilary functions (inherited from)------------------------- */
 
-template <typename Data>
-typename SetLst<Data>::Node* SetLst<Data>::BSearchEqPred(const Data &key, bool * check) const
+template <typename Data, typename Compare>
+typename SetLst<Data, Compare>::Node* SetLst<Data, Compare>::BSearchEqPred(const Data &key, bool * check) const
 {
     ulong length = size;
 
@@ -564,13 +657,13 @@ typename SetLst<Data>::Node* SetLst<Data>::BSearchEqPred(const Data &key, bool *
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem < key)
+       if(compare(walk_ptr->elem, key))
        {
             pred = walk_ptr;
             reminder = walk_ptr->next;
             length -= mid+1;
        }
-       else if(walk_ptr->elem > key)
+       else if(compare(key, walk_ptr->elem))
        {
             length = mid;
        }
@@ -583,8 +676,8 @@ typename SetLst<Data>::Node* SetLst<Data>::BSearchEqPred(const Data &key, bool *
     return pred;
 } 
 
-template <typename Data>
-typename SetLst<Data>::Node* SetLst<Data>::BSearchPred(const Data &key, bool * check) const // -1-> 1-> 2-> 3-> 4-> 5-> 7-> 8-> 
+template <typename Data, typename Compare>
+typename SetLst<Data, Compare>::Node* SetLst<Data, Compare>::BSearchPred(const Data &key, bool * check) const // -1-> 1-> 2-> 3-> 4-> 5-> 7-> 8-> 
 {
     ulong length = size;
 
@@ -607,13 +700,13 @@ typename SetLst<Data>::Node* SetLst<Data>::BSearchPred(const Data &key, bool * c
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem > key)
+       if(compare(key, walk_ptr->elem))
        {
             length = mid;
        }
        else
        {
-            if(walk_ptr->elem == key)
+            if(!compare(walk_ptr->elem, key))
             {
                 pred = predwalk_ptr;
                 *check = true;
@@ -628,8 +721,8 @@ typename SetLst<Data>::Node* SetLst<Data>::BSearchPred(const Data &key, bool * c
     return pred;
 } 
 
-template <typename Data>
-typename SetLst<Data>::Node* SetLst<Data>::BSearchSucc(const Data &key, bool * check) const
+template <typename Data, typename Compare>
+typename SetLst<Data, Compare>::Node* SetLst<Data, Compare>::BSearchSucc(const Data &key, bool * check) const
 {
     ulong length = size;
 
@@ -647,12 +740,12 @@ typename SetLst<Data>::Node* SetLst<Data>::BSearchSucc(const Data &key, bool * c
        if(!walk_ptr) 
             break;
 
-       if(walk_ptr->elem > key)
+       if(compare(key, walk_ptr->elem))
        {
             succ = walk_ptr;
             length = mid;
        }
-       else if(walk_ptr->elem < key)
+       else if(compare(walk_ptr->elem, key))
        {
             reminder = walk_ptr->next;
             length -= mid+1;
@@ -4,6 +4,10 @@
 
 /* ************************************************************************** */
 
+#include <functional>
+
+/* ************************************************************************** */
+
 #include "../set.hpp"
 #include "../../list/list.hpp"
 
@@ -13,7 +17,8 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
+// Compare gives the order of the keys: two keys are the same when neither precedes the other
+template <typename Data, typename Compare = std::less<Data>>
 class SetLst : virtual public Set<Data>,
                virtual protected List<Data>{
   // Must extend Set<Data>,
@@ -29,6 +34,8 @@ protected:
   using typename List<Data>::Node;
   using List<Data>::head;
   using List<Data>::tail;
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
   
 public:         
 
@@ -88,6 +95,14 @@ public:
   Data SuccessorNRemove(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
   void RemoveSuccessor(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  void TraverseRange(const Data &, const Data &, RangeFun) const override; // Override OrderedDictionaryContainer member
+  ulong CountRange(const Data &, const Data &) const override; // Override OrderedDictionaryContainer member
+  ulong RemoveRange(const Data &, const Data &) override; // Override OrderedDictionaryContainer member
+
+  ulong Rank(const Data &) const override; // Override OrderedDictionaryContainer member
+  const Data & Select(ulong) const override; // Override OrderedDictionaryContainer member (must throw std::out_of_range when out of range)
+
   /* ************************************************************************ */
 
   // Specific member functions (inherited from DictionaryContainer)
@@ -6,6 +6,7 @@
 
 #include "../container/dictionary.hpp"
 #include "../container/traversable.hpp"
+#include "../container/linear.hpp"
 
 /* ************************************************************************** */
 
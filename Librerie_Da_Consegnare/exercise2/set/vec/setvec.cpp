@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
 #include "setvec.hpp"
 
 namespace lasd {
@@ -7,33 +12,41 @@ namespace lasd {
 /* ---------------------------SetVec: Specific Constructors/Destructors-------------------------- */
 
 // Specific constructors
-template <typename Data>
-SetVec<Data>::SetVec(const TraversableContainer<Data> &cont) : SetVec<Data>(cont.Size()) // A set obtained from a TraversableContainer
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(const TraversableContainer<Data> &cont) : SetVec<Data, Compare>(cont.Size()) // A set obtained from a TraversableContainer
 {
+    ulong index = 0;
+
     cont.Traverse
     (
-        [this] (const Data &curr)
+        [this, &index] (const Data &curr)
         {   
-            Insert(curr);
+            Elements[index++] = curr;
         }
     );
+
+    BulkBuild(index);
 }
 
-template <typename Data>
-SetVec<Data>::SetVec(MappableContainer<Data> &&cont) : SetVec<Data>(cont.Size()) // A set obtained from a MappableContainer
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(MappableContainer<Data> &&cont) : SetVec<Data, Compare>(cont.Size()) // A set obtained from a MappableContainer
 {
+    ulong index = 0;
+
     cont.Map
     (
-        [this] (Data &curr)
+        [this, &index] (Data &curr)
         {
-            Insert(std::move(curr));
+            Elements[index++] = std::move(curr);
         }
     );
+
+    BulkBuild(index);
 }
 
 // Copy constructor
-template <typename Data>
-SetVec<Data>::SetVec(const SetVec &vec) : SetVec<Data>(vec.capacity)
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(const SetVec &vec) : SetVec<Data, Compare>(vec.capacity)
     {
         this->size = vec.size;
         this->head = vec.head;
@@ -43,8 +56,8 @@ SetVec<Data>::SetVec(const SetVec &vec) : SetVec<Data>(vec.capacity)
     }
 
 // Move constructor
-template <typename Data>
-SetVec<Data>::SetVec(SetVec &&vec) noexcept
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(SetVec &&vec) noexcept
 {
     std::swap(this->Elements, vec.Elements);
     std::swap(this->capacity, vec.capacity);
@@ -55,10 +68,10 @@ SetVec<Data>::SetVec(SetVec &&vec) noexcept
 /* ---------------------------SetVec: Assignments-------------------------- */
 
 // Copy assignment
-template <typename Data>
-SetVec<Data> & SetVec<Data>::operator=(const SetVec &vec)
+template <typename Data, typename Compare>
+SetVec<Data, Compare> & SetVec<Data, Compare>::operator=(const SetVec &vec)
 {
-    SetVec<Data> * tmp = new SetVec<Data>(vec);
+    SetVec<Data, Compare> * tmp = new SetVec<Data, Compare>(vec);
 
     std::swap(*tmp, *this);
     delete tmp;
@@ -67,8 +80,8 @@ SetVec<Data> & SetVec<Data>::operator=(const SetVec &vec)
 }
 
 // Move assignment
-template <typename Data>
-SetVec<Data> & SetVec<Data>::operator=(SetVec &&vec) noexcept
+template <typename Data, typename Compare>
+SetVec<Data, Compare> & SetVec<Data, Compare>::operator=(SetVec &&vec) noexcept
 {
     std::swap(this->Elements, vec.Elements);
     std::swap(this->capacity, vec.capacity);
@@ -80,8 +93,8 @@ SetVec<Data> & SetVec<Data>::operator=(SetVec &&vec) noexcept
 
 /* ---------------------------SetVec: Comparison Operators-------------------------- */
 
-template <typename Data>
-bool SetVec<Data>::operator==(const SetVec &vec) const noexcept
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::operator==(const SetVec &vec) const noexcept
 {
     if(this->size == vec.size)
     {
@@ -93,16 +106,24 @@ bool SetVec<Data>::operator==(const SetVec &vec) const noexcept
     return false;
 }
 
-template <typename Data>
-inline bool SetVec<Data>::operator!=(const SetVec &vec) const noexcept
+template <typename Data, typename Compare>
+inline bool SetVec<Data, Compare>::operator!=(const SetVec &vec) const noexcept
 {
     return !((*this) == vec);
 }
 
+/* ---------------------------SetVec: Specific member functions------------------------- */
+
+template <typename Data, typename Compare>
+FrozenSet<Data, Compare> SetVec<Data, Compare>::Freeze() const
+{
+    return FrozenSet<Data, Compare>(*this);
+}
+
 /* ---------------------------SetVec: Specific member functions (inherited from OrderedDictionaryContainer)------------------------- */
 
-template <typename Data>
-const Data & SetVec<Data>::Min() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+const Data & SetVec<Data, Compare>::Min() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(size == 0)
         throw std::length_error("Empty Exception from SetVec\n");
@@ -110,15 +131,15 @@ const Data & SetVec<Data>::Min() const // Override OrderedDictionaryContainer me
     return (*this)[0];
 }
 
-template <typename Data>
-Data SetVec<Data>::MinNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::MinNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(size == 0)
         throw std::length_error("Empty Exception from SetVec\n");
 
     Data tmpMin = std::move((*this)[0]);
 
-    head = (head + 1) % capacity; 
+    head = (head + 1) & (capacity - 1); 
     size--;
 
     checkResize();
@@ -126,20 +147,20 @@ Data SetVec<Data>::MinNRemove() // Override OrderedDictionaryContainer member (c
     return tmpMin;
 }
 
-template <typename Data>
-void SetVec<Data>::RemoveMin() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveMin() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(size == 0)
         throw std::length_error("Empty Exception from SetVec\n");
 
-    head = (head + 1) % capacity;
+    head = (head + 1) & (capacity - 1);
     size--;
    
     checkResize();
 }
 
-template <typename Data>
-const Data & SetVec<Data>::Max() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+const Data & SetVec<Data, Compare>::Max() const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(size == 0)
         throw std::length_error("Empty Exception from SetVec\n");
@@ -147,8 +168,8 @@ const Data & SetVec<Data>::Max() const // Override OrderedDictionaryContainer me
     return (*this)[size - 1];
 }
 
-template <typename Data>
-Data SetVec<Data>::MaxNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::MaxNRemove() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(size == 0)
         throw std::length_error("Empty Exception from SetVec\n");
@@ -164,8 +185,8 @@ Data SetVec<Data>::MaxNRemove() // Override OrderedDictionaryContainer member (c
     return tmpMax;
 }
 
-template <typename Data>
-void SetVec<Data>::RemoveMax() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveMax() // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
 {
     if(size == 0)
         throw std::length_error("Empty Exception from SetVec\n");
@@ -177,8 +198,8 @@ void SetVec<Data>::RemoveMax() // Override OrderedDictionaryContainer member (co
     checkResize();
 }
 
-template <typename Data>
-const Data & SetVec<Data>::Predecessor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+const Data & SetVec<Data, Compare>::Predecessor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     ulong index = BSearchPred(key);
 
@@ -188,8 +209,8 @@ const Data & SetVec<Data>::Predecessor(const Data &key) const // Override Ordere
     return (*this)[index];    
 }
 
-template <typename Data>
-Data SetVec<Data>::PredecessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::PredecessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     ulong index = BSearchPred(key);
 
@@ -203,8 +224,8 @@ Data SetVec<Data>::PredecessorNRemove(const Data &key) // Override OrderedDictio
     return tmpPred;
 }
 
-template <typename Data>
-void SetVec<Data>::RemovePredecessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemovePredecessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     ulong index = BSearchPred(key);
 
@@ -214,8 +235,8 @@ void SetVec<Data>::RemovePredecessor(const Data &key) // Override OrderedDiction
     IndexedRemove(index);
 }
 
-template <typename Data>
-const Data & SetVec<Data>::Successor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+const Data & SetVec<Data, Compare>::Successor(const Data &key) const // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     ulong index = BSearchSucc(key);
 
@@ -225,8 +246,8 @@ const Data & SetVec<Data>::Successor(const Data &key) const // Override OrderedD
     return (*this)[index];   
 }
 
-template <typename Data>
-Data SetVec<Data>::SuccessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+Data SetVec<Data, Compare>::SuccessorNRemove(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     ulong index = BSearchSucc(key);
 
@@ -240,8 +261,8 @@ Data SetVec<Data>::SuccessorNRemove(const Data &key) // Override OrderedDictiona
     return tmpSucc;
 }
 
-template <typename Data>
-void SetVec<Data>::RemoveSuccessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RemoveSuccessor(const Data &key) // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 {
     ulong index = BSearchSucc(key);
 
@@ -251,93 +272,98 @@ void SetVec<Data>::RemoveSuccessor(const Data &key) // Override OrderedDictionar
     IndexedRemove(index);
 }
 
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::TraverseRange(const Data &first, const Data &last, RangeFun fun) const
+{
+    for(ulong i = LowerBound(first); i < size && !compare(last, Elements[RingIndex(i)]); i++)
+        fun(Elements[RingIndex(i)]);
+}
+
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::CountRange(const Data &first, const Data &last) const
+{
+    ulong i = LowerBound(first);
+    ulong j = UpperBound(last);
+
+    return (j > i) ? j - i : 0;
+}
+
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::RemoveRange(const Data &first, const Data &last)
+{
+    ulong i = LowerBound(first);
+    ulong j = UpperBound(last);
+
+    if(j <= i)
+        return 0;
+
+    ulong removed = j - i;
+
+    // Un solo spostamento di blocco: chiudo il buco dal lato con meno elementi
+    if(i >= size - j)
+        LeftShift(j, size - j, removed);
+    else
+    {
+        RightShift(0, i, removed);
+        head = (head + removed) & (capacity - 1);
+    }
+
+    size -= removed;
+
+    if(size == 0)
+        head = 0;
+
+    if(size * 4 <= capacity && capacity > 2)
+        Resize(std::max(std::bit_ceil(2 * size), 2UL));
+
+    return removed;
+}
+
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::Rank(const Data &key) const
+{
+    return LowerBound(key);
+}
+
+template <typename Data, typename Compare>
+const Data & SetVec<Data, Compare>::Select(ulong index) const
+{
+    if(index >= size)
+        throw std::out_of_range("Out Of Range Exception from SetVec");
+
+    return Elements[RingIndex(index)];
+}
+
 /* ---------------------------SetVec: Specific member functions (inherited from DictionaryContainer)------------------------- */
 
-template <typename Data>
-bool SetVec<Data>::Insert(const Data &key) // Override DictionaryContainer member (copy of the value)
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Insert(const Data &key) // Override DictionaryContainer member (copy of the value)
 {
-    checkResize();
-    
     ulong i = BSearchEqPred(key);
     
-    if(i != size && (*this)[i] == key)
+    if(i != size && !compare((*this)[i], key))
         return false;
-    
-    if(i == size)    // Devo inserire in testa prima di head (size == 0 o pred trovato)
-    {
-        head = (head == 0) ? capacity - 1 : head - 1; 
-        Elements[head] = key;
-    }
-    else if (i == size - 1) // Devo inserire in coda dopo tail (binary va su size - 1)
-    {
-        Elements[(head + size) % capacity] = key;
-    }
-    else
-    {
-        ulong left_elems = i + 1;
-        ulong right_elems = size - left_elems;
 
-        if(left_elems >= right_elems)
-        {
-
-            RightShift(i + 1, right_elems);
-            (*this)[i + 1] = key;
-        } 
-        else
-        {
-            LeftShift(0, left_elems);
-            (*this)[i] = key;
-            head = (head == 0) ? capacity - 1 : head - 1;
-        }
-    }
+    IndexedInsert((i == size) ? 0 : i + 1, key); // Devo inserire dopo il pred (in testa se non esiste)
 
-    size++;
     return true;
 }
 
-template <typename Data>
-bool SetVec<Data>::Insert(Data &&key) // Override DictionaryContainer member (move of the value)
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Insert(Data &&key) // Override DictionaryContainer member (move of the value)
 {
-    checkResize();
-    
     ulong i = BSearchEqPred(key);
     
-    if(i != size && (*this)[i] == key)
+    if(i != size && !compare((*this)[i], key))
         return false;
-    
-    if(i == size)    // Devo inserire in testa prima di head (size == 0 o pred trovato)
-    {
-        head = (head == 0) ? capacity - 1 : head - 1; 
-        Elements[head] = std::move(key);
-    }
-    else if (i == size - 1) // Devo inserire in coda dopo tail (binary va su size - 1)
-    {
-        Elements[(head + size) % capacity] = std::move(key);
-    }
-    else
-    {
-        ulong left_elems = i + 1;
-        ulong right_elems = size - left_elems;
 
-        if(left_elems >= right_elems)
-        {
-            RightShift(i + 1, right_elems);
-            (*this)[i + 1] = std::move(key);
-        } 
-        else
-        {
-            LeftShift(0, left_elems);
-            (*this)[i] = std::move(key);
-            head = (head == 0) ? capacity - 1 : head - 1;
-        }
-    }
+    IndexedInsert((i == size) ? 0 : i + 1, std::move(key)); // Devo inserire dopo il pred (in testa se non esiste)
 
-    size++;
     return true;
 }
 
-template <typename Data>
-bool SetVec<Data>::Remove(const Data &key) // Override DictionaryContainer member
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Remove(const Data &key) // Override DictionaryContainer member
 {   
     ulong i = BSearchExists(key);
     
@@ -351,26 +377,38 @@ bool SetVec<Data>::Remove(const Data &key) // Override DictionaryContainer membe
 
 /* ---------------------------SetVec: Specific member functions (inherited from LinearContainer)------------------------- */
 
-template <typename Data>
-inline const Data & SetVec<Data>::operator[](const ulong offset) const
+template <typename Data, typename Compare>
+inline const Data & SetVec<Data, Compare>::operator[](const ulong offset) const
 {
     if(offset >= size)
         throw std::out_of_range("Out Of Range Exception from LinearContainer(SetVec) \n");
 
-    return Elements[(head + offset) % capacity];
+    return Elements[RingIndex(offset)];
 }
 /* ---------------------------SetVec: Specific member functions (inherited from TestableContainer)------------------------- */
 
-template <typename Data>
-bool SetVec<Data>::Exists(const Data &key) const noexcept
+template <typename Data, typename Compare>
+bool SetVec<Data, Compare>::Exists(const Data &key) const noexcept
 {
+    if constexpr (SimdScalar<Data> && NaturalOrder)
+    {
+        if(size <= LinearSearchMax)
+        {
+            // Al piu' due segmenti contigui del buffer circolare
+            ulong first = std::min(size, capacity - head);
+
+            return (LinearFind(Elements + head, first, key) != first
+                    || LinearFind(Elements, size - first, key) != size - first);
+        }
+    }
+
     return (BSearchExists(key) != size);
 }
 
 /* ---------------------------SetVec: Specific member functions (inherited from ClearableContainer)------------------------- */
 
-template <typename Data>
-void SetVec<Data>::Clear()
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::Clear()
 {
     delete[] Elements;
     Elements = new Data[2] {};
@@ -381,46 +419,115 @@ void SetVec<Data>::Clear()
 
 /* ---------------------------SetVec: Protected auxilary functions------------------------- */
 
-template<typename Data>
-SetVec<Data>::SetVec(ulong newCapacity)
+template <typename Data, typename Compare>
+SetVec<Data, Compare>::SetVec(ulong newCapacity)
 {
-    Elements = new Data[newCapacity] {};
-    capacity = newCapacity;
+    capacity = std::bit_ceil(std::max(newCapacity, 2UL)); // Capacita' sempre potenza di 2: l'indice circolare e' una maschera
+    Elements = new Data[capacity] {};
     size = 0;
     head = 0;
 }
 
-template <typename Data>
-inline Data & SetVec<Data>::operator[](const ulong offset) 
+template <typename Data, typename Compare>
+inline Data & SetVec<Data, Compare>::operator[](const ulong offset) 
 {
     if(offset >= size)
         throw std::out_of_range("Out Of Range Exception from LinearContainer(SetVec) \n");
 
-    return Elements[(head + offset) % capacity];
+    return Elements[RingIndex(offset)];
+}
+
+template <typename Data, typename Compare>
+inline ulong SetVec<Data, Compare>::RingIndex(ulong offset) const noexcept
+{
+    return (head + offset) & (capacity - 1);
+}
+
+// Gli shift spostano blocchi contigui: al piu' tre blocchi (le due parti del buffer e l'elemento a cavallo)
+
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::RightShift(ulong index, ulong to_shift, ulong distance) // [index, index + to_shift) -> [index + distance, index + to_shift + distance)
+{
+    ulong mask = capacity - 1;
+
+    while(to_shift > 0)
+    {
+        ulong srcEnd = ((head + index + to_shift - 1) & mask) + 1;
+        ulong dstEnd = ((head + index + to_shift - 1 + distance) & mask) + 1;
+        ulong block = std::min({to_shift, srcEnd, dstEnd});
+
+        BlockMove(Elements + dstEnd - block, Elements + srcEnd - block, block);
+        to_shift -= block;
+    }
 }
 
-template<typename Data>
-void SetVec<Data>::RightShift(ulong index, ulong to_shift)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::LeftShift(ulong index, ulong to_shift, ulong distance) // [index, index + to_shift) -> [index - distance, index + to_shift - distance)
 {
-    if(index + to_shift == size)
+    ulong mask = capacity - 1;
+    ulong src = (head + index) & mask;
+    ulong dst = (head + index - distance) & mask;
+
+    while(to_shift > 0)
     {
-        Elements[(index + head + to_shift) % capacity] = Elements[(index + head + to_shift + capacity - 1) % capacity];
-        --to_shift;
+        ulong block = std::min({to_shift, capacity - src, capacity - dst});
+
+        BlockMove(Elements + dst, Elements + src, block);
+        src = (src + block) & mask;
+        dst = (dst + block) & mask;
+        to_shift -= block;
     }
-    for(ulong i = to_shift; i > 0; i--)
-        (*this)[index + i] = (*this)[index + i - 1];
 }
 
-template<typename Data>
-void SetVec<Data>::LeftShift(ulong index, ulong to_shift)
+template <typename Data, typename Compare>
+inline void SetVec<Data, Compare>::BlockMove(Data * dst, Data * src, ulong count) // Le due zone possono sovrapporsi
+{
+    if constexpr (std::is_trivially_copyable_v<Data>)
+        std::memmove(static_cast<void *>(dst), static_cast<const void *>(src), count * sizeof(Data));
+    else if(dst < src)
+        std::move(src, src + count, dst);
+    else
+        std::move_backward(src, src + count, dst + count);
+}
+
+template <typename Data, typename Compare>
+template <typename Value>
+void SetVec<Data, Compare>::IndexedInsert(ulong to_insert, Value &&key) // Quando ho già la posizione (0 <= to_insert <= size)
 {
-    for(ulong i = 0 ; i < to_shift; i++)
-        Elements[(index + i + head + capacity - 1) % capacity] = 
-        Elements[(index + i + head) % capacity];
+    checkResize();
+
+    if(to_insert == 0)    // Devo inserire in testa prima di head
+    {
+        head = (head - 1) & (capacity - 1); 
+        Elements[head] = std::forward<Value>(key);
+    }
+    else if (to_insert == size) // Devo inserire in coda dopo tail
+    {
+        Elements[RingIndex(size)] = std::forward<Value>(key);
+    }
+    else
+    {
+        ulong left_elems = to_insert;
+        ulong right_elems = size - left_elems;
+
+        if(left_elems >= right_elems)
+        {
+            RightShift(to_insert, right_elems);
+        } 
+        else
+        {
+            LeftShift(0, left_elems);
+            head = (head - 1) & (capacity - 1);
+        }
+
+        Elements[RingIndex(to_insert)] = std::forward<Value>(key);
+    }
+
+    size++;
 }
 
-template <typename Data>
-void SetVec<Data>::IndexedRemove(ulong to_remove) // Quando ho già la posizione
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::IndexedRemove(ulong to_remove) // Quando ho già la posizione
 {
     ulong left_elems = to_remove;
     ulong right_elems = size - to_remove - 1;
@@ -435,7 +542,7 @@ void SetVec<Data>::IndexedRemove(ulong to_remove) // Quando ho già la posizione
         if(left_elems > 0)
             RightShift(0, left_elems);
         
-        head = (head + 1) % capacity;
+        head = (head + 1) & (capacity - 1);
     }
 
     size--;
@@ -445,8 +552,36 @@ void SetVec<Data>::IndexedRemove(ulong to_remove) // Quando ho già la posizione
     checkResize();
 }
 
-template <typename Data>
-void SetVec<Data>::checkResize()
+// Costruzione in blocco: ordinamento parallelo degli elementi copiati, poi rimozione dei duplicati
+// (O(n log n) invece di n inserimenti con spostamento)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::BulkBuild(ulong count)
+{
+    // Un contenitore gia' ordinato (per esempio l'uscita di KWayMerge) costa un solo passaggio
+    if(!std::is_sorted(Elements, Elements + count, compare))
+        ParallelSort(Elements, count, Executor::Default(), compare);
+
+    ulong unique = (count > 0) ? 1 : 0;
+
+    for(ulong i = 1; i < count; i++)
+        if(compare(Elements[unique - 1], Elements[i]))
+        {
+            if(i != unique)
+                Elements[unique] = std::move(Elements[i]);
+            unique++;
+        }
+
+    for(ulong i = unique; i < count; i++)
+        Elements[i] = Data {};
+
+    head = 0;
+    size = unique;
+
+    checkResize();
+}
+
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::checkResize()
 { 
     if(capacity < 2) 
     {
@@ -463,16 +598,17 @@ void SetVec<Data>::checkResize()
         Resize(capacity * 2);
 }
 
-// From ResizableContainer
-template <typename Data>
-void SetVec<Data>::Resize(ulong newCapacity)
+// From ResizableContainer (newCapacity potenza di 2)
+template <typename Data, typename Compare>
+void SetVec<Data, Compare>::Resize(ulong newCapacity)
 {
     Data * resElements = new Data[newCapacity] {};
 
     ulong newHead = (newCapacity - size) / 2;
-    
-    for(ulong i = 0; i < size; i++)
-        resElements[i + newHead] = (*this)[i];
+    ulong firstBlock = std::min(size, capacity - head);
+
+    std::move(Elements + head, Elements + head + firstBlock, resElements + newHead);
+    std::move(Elements, Elements + size - firstBlock, resElements + newHead + firstBlock);
 
     std::swap(Elements, resElements);
 
@@ -483,129 +619,77 @@ void SetVec<Data>::Resize(ulong newCapacity)
     resElements = nullptr;
 }
 
-// Ricerche specializzate per evitare confronti di uguaglianza nelle funzioni 
+// Ricerche specializzate per evitare confronti di uguaglianza nelle funzioni:
+// due elementi sono uguali quando nessuno dei due precede l'altro secondo Compare
+// Tutte si riducono a PartitionPoint: niente operator[] controllato e niente salti nel ciclo
 
-template <typename Data>
-ulong SetVec<Data>::BSearchExists(const Data &key) const // Cerca == Key
+template <typename Data, typename Compare>
+template <typename Pred>
+ulong SetVec<Data, Compare>::PartitionPoint(Pred pred) const noexcept // Gli elementi che soddisfano pred precedono tutti gli altri
 {
     if(size == 0)
-        return size;
-    
-    ulong i = 0;
-    ulong j = size - 1;
+        return 0;
+
+    ulong mask = capacity - 1;
+    ulong base = 0;
+    ulong len = size;
 
-    while(i <= j)
+    while(len > 1)
     {
-        ulong q = i + (j - i) / 2;
-
-        if((*this)[q] == key)
-            return q; 
-        if((*this)[q] < key)
-            {
-                i = q + 1;
-            }
-        else
-        {
-            if(q==0)
-                break;
-            
-            j = q - 1;
-        }
-    }
-    return size;
-}
+        ulong half = len / 2;
+        ulong next = (len - half) / 2;
 
-template<typename Data>
-ulong SetVec<Data>::BSearchEqPred(const Data &key) const // Cerca <= key
-{
-    if(size == 0)
-        return size;
-    
-    ulong i = 0;
-    ulong j = size - 1;
-    ulong pred_idx = size;
+        // I due possibili punti medi del passo successivo
+        __builtin_prefetch(&Elements[(head + base + next) & mask]);
+        __builtin_prefetch(&Elements[(head + base + half + next) & mask]);
 
-    while(i <= j)
-    {
-        ulong q = i + (j - i) / 2;
-
-        if((*this)[q] == key)
-            return q; 
-        if((*this)[q] < key)
-            {
-                pred_idx = q;
-                i = q + 1;
-            }
-        else
-        {
-            if(q==0)
-                break;
-            
-            j = q - 1;
-        }
+        base = pred(Elements[(head + base + half) & mask]) ? base + half : base;
+        len -= half;
     }
-    return pred_idx;
-}
 
+    return base + static_cast<ulong>(pred(Elements[(head + base) & mask]));
+}
 
-template<typename Data>
-ulong SetVec<Data>::BSearchPred(const Data &key) const
+template <typename Data, typename Compare>
+inline ulong SetVec<Data, Compare>::LowerBound(const Data &key) const noexcept // Primo elemento >= key
 {
-    if(size == 0)
-        return size;
-
-    ulong i = 0;
-    ulong j = size - 1;
-    ulong pred_idx = size;
+    return PartitionPoint([this, &key] (const Data &curr) { return compare(curr, key); });
+}
 
-    while (i <= j)
-    {
-        ulong q = i + (j - i) / 2;
+template <typename Data, typename Compare>
+inline ulong SetVec<Data, Compare>::UpperBound(const Data &key) const noexcept // Primo elemento > key
+{
+    return PartitionPoint([this, &key] (const Data &curr) { return !compare(key, curr); });
+}
 
-        if ((*this)[q] < key)
-        {
-            pred_idx = q;
-            i = q + 1;
-        } 
-        else
-        {
-            if(q == 0)
-                break;
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::BSearchExists(const Data &key) const // Cerca == Key
+{
+    ulong i = LowerBound(key);
 
-            j = q - 1;
-        }
-    }
-    return pred_idx;
+    return (i != size && !compare(key, Elements[RingIndex(i)])) ? i : size;
 }
 
-template<typename Data>
-ulong SetVec<Data>::BSearchSucc(const Data &key) const
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::BSearchEqPred(const Data &key) const // Cerca <= key
 {
-    if(size == 0)
-        return size;
+    ulong i = UpperBound(key);
 
-    ulong i = 0;
-    ulong j = size - 1;
-    ulong succ_idx = size;
+    return (i == 0) ? size : i - 1;
+}
 
-    while (i <= j) 
-    {
-        ulong q = i + (j - i) / 2;
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::BSearchPred(const Data &key) const // Cerca < key
+{
+    ulong i = LowerBound(key);
 
-        if ((*this)[q] > key)
-        {
-            succ_idx = q;
-            if (q == 0) 
-                break;
+    return (i == 0) ? size : i - 1;
+}
 
-            j = q - 1;
-        } 
-        else
-        {
-            i = q + 1;
-        }
-    }
-    return succ_idx;
+template <typename Data, typename Compare>
+ulong SetVec<Data, Compare>::BSearchSucc(const Data &key) const // Cerca > key
+{
+    return UpperBound(key);
 }
 
 }
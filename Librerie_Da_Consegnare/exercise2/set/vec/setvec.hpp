@@ -4,8 +4,14 @@
 
 /* ************************************************************************** */
 
+#include <functional>
+#include <type_traits>
+
+/* ************************************************************************** */
+
 #include "../set.hpp"
 #include "../../vector/vector.hpp"
+#include "../frozen/frozenset.hpp"
 
 /* ************************************************************************** */
 
@@ -13,7 +19,8 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
+// Compare gives the order of the keys: two keys are the same when neither precedes the other
+template <typename Data, typename Compare = std::less<Data>>
 class SetVec : virtual public Set<Data>,
                virtual protected Vector<Data>,
                virtual protected ResizableContainer
@@ -31,7 +38,12 @@ protected:
   using Vector<Data>::Elements; 
 
   ulong head = 0;
-  ulong capacity = 0;
+  ulong capacity = 0; // Always a power of two
+
+  [[no_unique_address]] Compare compare; // Stateless comparators take no space
+
+  static constexpr ulong LinearSearchMax = 64; // Below this size Exists scans linearly (arithmetic types only)
+  static constexpr bool NaturalOrder = std::is_same_v<Compare, std::less<Data>> || std::is_same_v<Compare, std::greater<Data>>; // Equivalent keys are equal
 
 public:
   
@@ -73,6 +85,12 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function
+
+  FrozenSet<Data, Compare> Freeze() const; // A read-only snapshot laid out for fast lookups
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from OrderedDictionaryContainer)
 
   const Data & Min() const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
@@ -91,6 +109,14 @@ public:
   Data SuccessorNRemove(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
   void RemoveSuccessor(const Data &) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  void TraverseRange(const Data &, const Data &, RangeFun) const override; // Override OrderedDictionaryContainer member
+  ulong CountRange(const Data &, const Data &) const override; // Override OrderedDictionaryContainer member
+  ulong RemoveRange(const Data &, const Data &) override; // Override OrderedDictionaryContainer member
+
+  ulong Rank(const Data &) const override; // Override OrderedDictionaryContainer member
+  const Data & Select(ulong) const override; // Override OrderedDictionaryContainer member (must throw std::out_of_range when out of range)
+
   /* ************************************************************************ */
 
   // Specific member functions (inherited from DictionaryContainer)
@@ -121,16 +147,31 @@ protected:
   
   SetVec(ulong);
 
-  void RightShift(ulong, ulong);
+  inline ulong RingIndex(ulong) const noexcept; // Physical position of a logical offset
+
+  void RightShift(ulong, ulong, ulong = 1);
+
+  void LeftShift(ulong, ulong, ulong = 1);
 
-  void LeftShift(ulong, ulong);
+  static inline void BlockMove(Data *, Data *, ulong);
+
+  template <typename Value>
+  void IndexedInsert(ulong, Value &&);
 
   void IndexedRemove(ulong);
 
+  void BulkBuild(ulong); // Sorts the first elements (unless already sorted) and drops the duplicates
+
   void checkResize();
 
   void Resize(ulong) override; 
 
+  template <typename Pred>
+  ulong PartitionPoint(Pred) const noexcept; // First position whose element does not satisfy the predicate
+
+  inline ulong LowerBound(const Data &) const noexcept; // First position with element >= the given one
+  inline ulong UpperBound(const Data &) const noexcept; // First position with element > the given one
+
   ulong BSearchExists(const Data &) const;  
   ulong BSearchEqPred(const Data &) const;
   ulong BSearchPred(const Data &) const;
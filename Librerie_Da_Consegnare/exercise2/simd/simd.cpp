@@ -0,0 +1,302 @@
+#include <cstring>
+
+#include "simd.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------Simd: Linear search kernels-------------------------- */
+
+template <typename Data>
+ulong LinearFind(const Data * elements, ulong length, const Data & key) noexcept
+{
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+        typedef unsigned long long Bits __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        Vec keys = Vec {} + key;
+
+        // Quattro vettori per iterazione: un solo test sul risultato combinato
+        for(; i + 4 * lanes <= length; i += 4 * lanes)
+        {
+            Vec a, b, c, d;
+            std::memcpy(&a, elements + i, sizeof(Vec));
+            std::memcpy(&b, elements + i + lanes, sizeof(Vec));
+            std::memcpy(&c, elements + i + 2 * lanes, sizeof(Vec));
+            std::memcpy(&d, elements + i + 3 * lanes, sizeof(Vec));
+
+            Bits hit = (Bits) ((a == keys) | (b == keys) | (c == keys) | (d == keys));
+
+            if((hit[0] | hit[1] | hit[2] | hit[3]) != 0)
+                break; // Il blocco contiene la chiave: la posizione esatta la trova il ciclo scalare
+        }
+    }
+
+    for(; i < length; i++)
+        if(elements[i] == key)
+            return i;
+
+    return length;
+}
+
+template <typename Data>
+ulong LinearCount(const Data * elements, ulong length, const Data & key) noexcept
+{
+    ulong count = 0;
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        Vec keys = Vec {} + key;
+
+        while(i + lanes <= length)
+        {
+            // Il confronto vale -1 sulle corsie uguali: sottraendo si contano le occorrenze,
+            // svuotando l'accumulatore prima che le corsie da 8 bit possano traboccare
+            decltype(Vec {} == Vec {}) acc = {};
+
+            for(ulong round = 0; round < 127 && i + lanes <= length; round++, i += lanes)
+            {
+                Vec v;
+                std::memcpy(&v, elements + i, sizeof(Vec));
+                acc -= (v == keys);
+            }
+
+            for(ulong lane = 0; lane < lanes; lane++)
+                count += static_cast<ulong>(acc[lane]);
+        }
+    }
+
+    for(; i < length; i++)
+        count += (elements[i] == key);
+
+    return count;
+}
+
+/* ---------------------------Simd: Reductions-------------------------- */
+
+template <typename Data>
+Data ArraySum(const Data * elements, ulong length) noexcept
+{
+    Data sum = 0;
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        // Quattro accumulatori indipendenti: le somme non aspettano l'una l'altra
+        Vec acc0 = {}, acc1 = {}, acc2 = {}, acc3 = {};
+
+        for(; i + 4 * lanes <= length; i += 4 * lanes)
+        {
+            Vec a, b, c, d;
+            std::memcpy(&a, elements + i, sizeof(Vec));
+            std::memcpy(&b, elements + i + lanes, sizeof(Vec));
+            std::memcpy(&c, elements + i + 2 * lanes, sizeof(Vec));
+            std::memcpy(&d, elements + i + 3 * lanes, sizeof(Vec));
+
+            acc0 += a;
+            acc1 += b;
+            acc2 += c;
+            acc3 += d;
+        }
+
+        Vec acc = (acc0 + acc1) + (acc2 + acc3);
+
+        for(ulong lane = 0; lane < lanes; lane++)
+            sum += acc[lane];
+    }
+
+    for(; i < length; i++)
+        sum += elements[i];
+
+    return sum;
+}
+
+template <typename Data>
+void ArrayMinMax(const Data * elements, ulong length, Data & min, Data & max) noexcept
+{
+    min = max = elements[0];
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        if(length >= 2 * lanes)
+        {
+            Vec lo0, lo1;
+            std::memcpy(&lo0, elements, sizeof(Vec));
+            std::memcpy(&lo1, elements + lanes, sizeof(Vec));
+            Vec hi0 = lo0, hi1 = lo1;
+
+            for(i = 2 * lanes; i + 2 * lanes <= length; i += 2 * lanes)
+            {
+                Vec a, b;
+                std::memcpy(&a, elements + i, sizeof(Vec));
+                std::memcpy(&b, elements + i + lanes, sizeof(Vec));
+
+                lo0 = (a < lo0) ? a : lo0;
+                lo1 = (b < lo1) ? b : lo1;
+                hi0 = (a > hi0) ? a : hi0;
+                hi1 = (b > hi1) ? b : hi1;
+            }
+
+            lo0 = (lo1 < lo0) ? lo1 : lo0;
+            hi0 = (hi1 > hi0) ? hi1 : hi0;
+
+            for(ulong lane = 0; lane < lanes; lane++)
+            {
+                min = (lo0[lane] < min) ? lo0[lane] : min;
+                max = (hi0[lane] > max) ? hi0[lane] : max;
+            }
+        }
+    }
+
+    for(; i < length; i++)
+    {
+        min = (elements[i] < min) ? elements[i] : min;
+        max = (elements[i] > max) ? elements[i] : max;
+    }
+}
+
+template <typename Data>
+Data ArrayDot(const Data * first, const Data * second, ulong length) noexcept
+{
+    Data dot = 0;
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        Vec acc0 = {}, acc1 = {};
+
+        for(; i + 2 * lanes <= length; i += 2 * lanes)
+        {
+            Vec a, b, c, d;
+            std::memcpy(&a, first + i, sizeof(Vec));
+            std::memcpy(&b, second + i, sizeof(Vec));
+            std::memcpy(&c, first + i + lanes, sizeof(Vec));
+            std::memcpy(&d, second + i + lanes, sizeof(Vec));
+
+            acc0 += a * b;
+            acc1 += c * d;
+        }
+
+        Vec acc = acc0 + acc1;
+
+        for(ulong lane = 0; lane < lanes; lane++)
+            dot += acc[lane];
+    }
+
+    for(; i < length; i++)
+        dot += first[i] * second[i];
+
+    return dot;
+}
+
+/* ---------------------------Simd: Elementwise transforms-------------------------- */
+
+template <typename Data>
+void ArrayScale(Data * elements, ulong length, const Data & factor) noexcept
+{
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        Vec factors = Vec {} + factor;
+
+        for(; i + lanes <= length; i += lanes)
+        {
+            Vec a;
+            std::memcpy(&a, elements + i, sizeof(Vec));
+            a *= factors;
+            std::memcpy(elements + i, &a, sizeof(Vec));
+        }
+    }
+
+    for(; i < length; i++)
+        elements[i] *= factor;
+}
+
+template <typename Data>
+void ArrayAdd(Data * elements, const Data * other, ulong length) noexcept
+{
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        for(; i + lanes <= length; i += lanes)
+        {
+            Vec a, b;
+            std::memcpy(&a, elements + i, sizeof(Vec));
+            std::memcpy(&b, other + i, sizeof(Vec));
+            a += b;
+            std::memcpy(elements + i, &a, sizeof(Vec));
+        }
+    }
+
+    for(; i < length; i++)
+        elements[i] += other[i];
+}
+
+template <typename Data>
+void ArrayClamp(Data * elements, ulong length, const Data & lo, const Data & hi) noexcept
+{
+    ulong i = 0;
+
+    if constexpr (SimdScalar<Data>)
+    {
+        typedef Data Vec __attribute__((vector_size(32)));
+
+        constexpr ulong lanes = sizeof(Vec) / sizeof(Data);
+
+        Vec los = Vec {} + lo;
+        Vec his = Vec {} + hi;
+
+        for(; i + lanes <= length; i += lanes)
+        {
+            Vec a;
+            std::memcpy(&a, elements + i, sizeof(Vec));
+            a = (a < los) ? los : a;
+            a = (a > his) ? his : a;
+            std::memcpy(elements + i, &a, sizeof(Vec));
+        }
+    }
+
+    for(; i < length; i++)
+    {
+        elements[i] = (elements[i] < lo) ? lo : elements[i];
+        elements[i] = (elements[i] > hi) ? hi : elements[i];
+    }
+}
+
+/* ************************************************************************** */
+
+}
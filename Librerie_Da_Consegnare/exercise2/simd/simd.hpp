@@ -0,0 +1,64 @@
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+/* ************************************************************************** */
+
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Kernels on contiguous arrays shared by the vector-based containers.
+// For arithmetic types they compare 32 bytes at a time with GCC vector extensions
+// (SSE2 on the baseline target, AVX2 when compiled with -mavx2); other types use a plain loop.
+
+template <typename Data>
+inline constexpr bool SimdScalar = (std::is_integral_v<Data> || std::is_floating_point_v<Data>)
+                                   && !std::is_same_v<Data, bool> && !std::is_same_v<Data, long double>;
+
+template <typename Data>
+ulong LinearFind(const Data *, ulong, const Data &) noexcept; // Position of the first occurrence (the length when not found)
+
+template <typename Data>
+ulong LinearCount(const Data *, ulong, const Data &) noexcept; // Number of occurrences
+
+/* ************************************************************************** */
+
+// Reductions and elementwise transforms for arithmetic types.
+// The reductions keep several partial results (one per lane of four vectors) and combine them
+// at the end: for floating point types the order of the additions differs from a sequential loop,
+// so the results may differ in the last bits.
+
+template <typename Data>
+Data ArraySum(const Data *, ulong) noexcept;
+
+template <typename Data>
+void ArrayMinMax(const Data *, ulong, Data &, Data &) noexcept; // (length must be positive)
+
+template <typename Data>
+Data ArrayDot(const Data *, const Data *, ulong) noexcept;
+
+template <typename Data>
+void ArrayScale(Data *, ulong, const Data &) noexcept; // a[i] *= factor
+
+template <typename Data>
+void ArrayAdd(Data *, const Data *, ulong) noexcept; // a[i] += b[i]
+
+template <typename Data>
+void ArrayClamp(Data *, ulong, const Data &, const Data &) noexcept; // a[i] = min(max(a[i], lo), hi)
+
+/* ************************************************************************** */
+
+}
+
+#include "simd.cpp"
+
+#endif
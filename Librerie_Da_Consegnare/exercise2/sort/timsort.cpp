@@ -0,0 +1,461 @@
+#include <algorithm>
+#include <utility>
+
+#include "timsort.hpp"
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+/* ---------------------------TimSort: Auxiliary functions-------------------------- */
+
+// Lunghezza minima delle run: tra 32 e 64, tale che n / minrun sia una potenza di due o poco meno
+inline ulong TimMinRun(ulong length) noexcept
+{
+    ulong odd = 0;
+
+    while(length >= 64)
+    {
+        odd |= length & 1;
+        length >>= 1;
+    }
+
+    return length + odd;
+}
+
+// Run naturale all'inizio dell'array: non decrescente, oppure strettamente decrescente e girata
+// (solo stretta, altrimenti girandola si scambierebbero elementi uguali)
+template <typename Data, typename Compare>
+ulong TimRun(Data * elements, ulong length, Compare comp)
+{
+    if(length < 2)
+        return length;
+
+    ulong end = 2;
+
+    if(comp(elements[1], elements[0]))
+    {
+        while(end < length && comp(elements[end], elements[end - 1]))
+            end++;
+
+        std::reverse(elements, elements + end);
+    }
+    else
+    {
+        while(end < length && !comp(elements[end], elements[end - 1]))
+            end++;
+    }
+
+    return end;
+}
+
+// Le prime sorted posizioni sono gia' ordinate; ogni nuovo elemento va dopo gli uguali (stabile).
+// Ricerca lineare e non binaria: su run cosi' corte costa meno dei salti mal predetti
+template <typename Data, typename Compare>
+void TimInsertion(Data * elements, ulong length, ulong sorted, Compare comp)
+{
+    for(ulong i = sorted; i < length; i++)
+    {
+        Data key = std::move(elements[i]);
+        ulong j = i;
+
+        while(j > 0 && comp(key, elements[j - 1]))
+        {
+            elements[j] = std::move(elements[j - 1]);
+            j--;
+        }
+
+        elements[j] = std::move(key);
+    }
+}
+
+// Prima posizione in cui key puo' andare prima degli uguali (elements[k - 1] < key <= elements[k]).
+// La ricerca parte da hint e raddoppia il passo, poi bisezione sull'ultimo intervallo: O(log d)
+// confronti, con d la distanza del risultato da hint
+template <typename Data, typename Compare>
+ulong TimGallopLeft(const Data &key, const Data * elements, ulong length, ulong hint, Compare comp)
+{
+    long last = 0, offset = 1;
+    long start = static_cast<long>(hint);
+
+    if(comp(elements[hint], key))
+    {
+        long max = static_cast<long>(length) - start;
+
+        while(offset < max && comp(elements[start + offset], key))
+        {
+            last = offset;
+            offset = 2 * offset + 1;
+        }
+
+        offset = std::min(offset, max);
+        last += start;
+        offset += start;
+    }
+    else
+    {
+        long max = start + 1;
+
+        while(offset < max && !comp(elements[start - offset], key))
+        {
+            last = offset;
+            offset = 2 * offset + 1;
+        }
+
+        offset = std::min(offset, max);
+        long tmp = last;
+        last = start - offset;
+        offset = start - tmp;
+    }
+
+    // Ora elements[last] < key <= elements[offset]
+    last++;
+
+    while(last < offset)
+    {
+        long mid = last + (offset - last) / 2;
+
+        if(comp(elements[mid], key))
+            last = mid + 1;
+        else
+            offset = mid;
+    }
+
+    return static_cast<ulong>(offset);
+}
+
+// Prima posizione dopo gli uguali a key (elements[k - 1] <= key < elements[k])
+template <typename Data, typename Compare>
+ulong TimGallopRight(const Data &key, const Data * elements, ulong length, ulong hint, Compare comp)
+{
+    long last = 0, offset = 1;
+    long start = static_cast<long>(hint);
+
+    if(comp(key, elements[hint]))
+    {
+        long max = start + 1;
+
+        while(offset < max && comp(key, elements[start - offset]))
+        {
+            last = offset;
+            offset = 2 * offset + 1;
+        }
+
+        offset = std::min(offset, max);
+        long tmp = last;
+        last = start - offset;
+        offset = start - tmp;
+    }
+    else
+    {
+        long max = static_cast<long>(length) - start;
+
+        while(offset < max && !comp(key, elements[start + offset]))
+        {
+            last = offset;
+            offset = 2 * offset + 1;
+        }
+
+        offset = std::min(offset, max);
+        last += start;
+        offset += start;
+    }
+
+    // Ora elements[last] <= key < elements[offset]
+    last++;
+
+    while(last < offset)
+    {
+        long mid = last + (offset - last) / 2;
+
+        if(comp(key, elements[mid]))
+            offset = mid;
+        else
+            last = mid + 1;
+    }
+
+    return static_cast<ulong>(offset);
+}
+
+// Fusione dal basso: la prima run (la piu' corta) va nel buffer e si riempie l'array da sinistra.
+// La destinazione non raggiunge mai la seconda run: resta indietro di quanto rimane nel buffer
+template <typename Data, typename Compare>
+ulong TimMergeLow(Data * elements, ulong len1, ulong len2, Data * buffer, ulong minGallop, Compare comp)
+{
+    Data * dest = elements;
+    Data * fst = buffer;
+    Data * fstEnd = buffer + len1;
+    Data * snd = elements + len1;
+    Data * sndEnd = snd + len2;
+
+    std::move(elements, elements + len1, buffer);
+
+    while(fst != fstEnd && snd != sndEnd)
+    {
+        ulong count1 = 0, count2 = 0;
+
+        // Uno a uno finche' una run non vince minGallop volte di fila; a parita' vince la prima (stabile)
+        while(fst != fstEnd && snd != sndEnd && (count1 | count2) < minGallop)
+        {
+            if(comp(*snd, *fst))
+            {
+                *dest++ = std::move(*snd++);
+                count2++;
+                count1 = 0;
+            }
+            else
+            {
+                *dest++ = std::move(*fst++);
+                count1++;
+                count2 = 0;
+            }
+        }
+
+        // Galoppo: blocchi interi di una run prima del prossimo elemento dell'altra
+        while(fst != fstEnd && snd != sndEnd)
+        {
+            ulong run1 = TimGallopRight(*snd, fst, fstEnd - fst, 0, comp);
+            dest = std::move(fst, fst + run1, dest);
+            fst += run1;
+
+            if(fst == fstEnd)
+                break;
+
+            *dest++ = std::move(*snd++);
+
+            if(snd == sndEnd)
+                break;
+
+            ulong run2 = TimGallopLeft(*fst, snd, sndEnd - snd, 0, comp);
+            dest = std::move(snd, snd + run2, dest);
+            snd += run2;
+
+            if(snd == sndEnd)
+                break;
+
+            *dest++ = std::move(*fst++);
+
+            // Blocchi corti: il galoppo non conviene, si torna al confronto uno a uno e si alza la soglia
+            if(run1 < TimGallop && run2 < TimGallop)
+            {
+                minGallop += 2;
+                break;
+            }
+
+            if(minGallop > 1)
+                minGallop--;
+        }
+    }
+
+    // Se e' finita la seconda run resta da copiare il buffer; altrimenti la seconda e' gia' al suo posto
+    std::move(fst, fstEnd, dest);
+
+    return minGallop;
+}
+
+// Fusione dall'alto: la seconda run (la piu' corta) va nel buffer e si riempie l'array da destra.
+// fst e snd puntano subito dopo l'ultimo elemento rimasto di ciascuna run, dest subito dopo la
+// prossima posizione da riempire
+template <typename Data, typename Compare>
+ulong TimMergeHigh(Data * elements, ulong len1, ulong len2, Data * buffer, ulong minGallop, Compare comp)
+{
+    Data * dest = elements + len1 + len2;
+    Data * fst = elements + len1;
+    Data * snd = buffer + len2;
+
+    std::move(elements + len1, elements + len1 + len2, buffer);
+
+    while(fst != elements && snd != buffer)
+    {
+        ulong count1 = 0, count2 = 0;
+
+        // A parita' va in fondo l'elemento della seconda run (stabile)
+        while(fst != elements && snd != buffer && (count1 | count2) < minGallop)
+        {
+            if(comp(snd[-1], fst[-1]))
+            {
+                *--dest = std::move(*--fst);
+                count1++;
+                count2 = 0;
+            }
+            else
+            {
+                *--dest = std::move(*--snd);
+                count2++;
+                count1 = 0;
+            }
+        }
+
+        while(fst != elements && snd != buffer)
+        {
+            ulong rem1 = fst - elements;
+            ulong run1 = rem1 - TimGallopRight(snd[-1], elements, rem1, rem1 - 1, comp);
+            dest = std::move_backward(fst - run1, fst, dest);
+            fst -= run1;
+
+            if(fst == elements)
+                break;
+
+            *--dest = std::move(*--snd);
+
+            if(snd == buffer)
+                break;
+
+            ulong rem2 = snd - buffer;
+            ulong run2 = rem2 - TimGallopLeft(fst[-1], buffer, rem2, rem2 - 1, comp);
+            dest = std::move_backward(snd - run2, snd, dest);
+            snd -= run2;
+
+            if(snd == buffer)
+                break;
+
+            *--dest = std::move(*--fst);
+
+            if(run1 < TimGallop && run2 < TimGallop)
+            {
+                minGallop += 2;
+                break;
+            }
+
+            if(minGallop > 1)
+                minGallop--;
+        }
+    }
+
+    // Se e' finita la prima run il resto del buffer va in testa; altrimenti la prima e' gia' al suo posto
+    std::move(buffer, snd, elements);
+
+    return minGallop;
+}
+
+// Fusione di due run adiacenti: la parte iniziale della prima minore o uguale all'inizio della
+// seconda e la parte finale della seconda maggiore o uguale alla fine della prima sono gia' al
+// loro posto; solo il resto passa per il buffer, grande quanto la piu' corta delle due
+template <typename Data, typename Compare>
+void TimMerge(Data * elements, ulong len1, ulong len2, Data *&buffer, ulong &capacity, ulong &minGallop, Compare comp)
+{
+    ulong skip = TimGallopRight(elements[len1], elements, len1, 0, comp);
+    elements += skip;
+    len1 -= skip;
+
+    if(len1 == 0)
+        return;
+
+    len2 = TimGallopLeft(elements[len1 - 1], elements + len1, len2, len2 - 1, comp);
+
+    if(len2 == 0)
+        return;
+
+    ulong needed = std::min(len1, len2);
+
+    if(capacity < needed)
+    {
+        // Prima l'allocazione, poi la fusione: se new fallisce l'array e' ancora intatto
+        Data * larger = new Data[needed];
+        delete[] buffer;
+        buffer = larger;
+        capacity = needed;
+    }
+
+    if(len1 <= len2)
+        minGallop = TimMergeLow(elements, len1, len2, buffer, minGallop, comp);
+    else
+        minGallop = TimMergeHigh(elements, len1, len2, buffer, minGallop, comp);
+}
+
+// Powersort: la potenza del confine tra due run consecutive e' il primo bit in cui differiscono
+// i loro punti medi, letti come frazioni di length. Si fondono le run in cima alla pila finche'
+// il loro confine e' piu' profondo del nuovo: le fusioni seguono un albero quasi bilanciato
+inline ulong TimPower(ulong start, ulong len1, ulong len2, ulong length) noexcept
+{
+    ulong power = 0;
+    ulong fst = 2 * start + len1; // Doppio dei punti medi
+    ulong snd = fst + len1 + len2;
+
+    while(true)
+    {
+        power++;
+
+        if(fst >= length)
+        {
+            fst -= length;
+            snd -= length;
+        }
+        else if(snd >= length)
+            return power;
+
+        fst <<= 1;
+        snd <<= 1;
+    }
+}
+
+/* ---------------------------TimSort-------------------------- */
+
+template <typename Data, typename Compare>
+void TimSort(Data * elements, ulong length, Compare comp)
+{
+    if(length < 2)
+        return;
+
+    ulong minRun = TimMinRun(length);
+
+    // Sulla pila le potenze crescono dal fondo alla cima e non superano i bit di length + 1
+    ulong starts[130], lengths[130], powers[130];
+    ulong top = 0;
+
+    Data * buffer = nullptr;
+    ulong capacity = 0;
+    ulong minGallop = TimGallop;
+
+    try
+    {
+        for(ulong start = 0; start < length; )
+        {
+            ulong run = TimRun(elements + start, length - start, comp);
+
+            if(run < minRun)
+            {
+                ulong extended = std::min(minRun, length - start);
+                TimInsertion(elements + start, extended, run, comp);
+                run = extended;
+            }
+
+            if(top > 0)
+            {
+                ulong power = TimPower(starts[top - 1], lengths[top - 1], run, length);
+
+                while(top > 1 && powers[top - 2] > power)
+                {
+                    TimMerge(elements + starts[top - 2], lengths[top - 2], lengths[top - 1], buffer, capacity, minGallop, comp);
+                    lengths[top - 2] += lengths[top - 1];
+                    top--;
+                }
+
+                powers[top - 1] = power;
+            }
+
+            starts[top] = start;
+            lengths[top] = run;
+            top++;
+
+            start += run;
+        }
+
+        for(; top > 1; top--)
+        {
+            TimMerge(elements + starts[top - 2], lengths[top - 2], lengths[top - 1], buffer, capacity, minGallop, comp);
+            lengths[top - 2] += lengths[top - 1];
+        }
+    }
+    catch(...)
+    {
+        delete[] buffer;
+        throw;
+    }
+
+    delete[] buffer;
+}
+
+/* ************************************************************************** */
+
+}
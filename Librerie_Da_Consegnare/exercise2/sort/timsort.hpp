@@ -0,0 +1,38 @@
+#ifndef TIMSORT_HPP
+#define TIMSORT_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+
+/* ************************************************************************** */
+
+#include "../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Adaptive stable merge sort on a contiguous array (TimSort). The array is split into natural
+// runs (non-decreasing, or strictly decreasing and then reversed), short ones extended to a
+// minimum length between 32 and 64 with linear insertion sort; the runs are merged following the powersort
+// policy, which keeps the merges balanced. Merges skip the parts of the two runs already in
+// place and switch to galloping (exponential search) while one run keeps winning.
+// O(n) on sorted or reversed input, O(n + n log r) with r runs, O(n log n) in the worst case;
+// extra memory for at most n / 2 elements (none when the array is a single run).
+// Stable: equal elements keep their order. The order is the one of the comparator (operator< by default).
+
+inline constexpr ulong TimGallop = 7; // Consecutive wins before galloping
+
+template <typename Data, typename Compare = std::less<Data>>
+void TimSort(Data *, ulong, Compare = Compare());
+
+/* ************************************************************************** */
+
+}
+
+#include "timsort.cpp"
+
+#endif
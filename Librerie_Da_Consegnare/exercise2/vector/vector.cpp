@@ -1,4 +1,5 @@
-// #include <cmath>
+#include <cmath>
+#include <type_traits>
 #include "vector.hpp"
 
 namespace lasd {
@@ -191,6 +192,178 @@ inline const Data & Vector<Data>::Back() const // Override LinearContainer membe
     return Elements[size - 1];
 }
 
+/* ---------------------------Vector: Member Functions (Search) -------------------------- */
+
+// Scansione diretta di Elements: niente std::function per elemento come in TraversableContainer::Exists
+
+template <typename Data>
+ulong Vector<Data>::Find(const Data &key) const noexcept
+{
+    return LinearFind(Elements, size, key);
+}
+
+template <typename Data>
+ulong Vector<Data>::Count(const Data &key) const noexcept
+{
+    return LinearCount(Elements, size, key);
+}
+
+template <typename Data>
+inline bool Vector<Data>::Exists(const Data &key) const noexcept
+{
+    return (Find(key) != size);
+}
+
+/* ---------------------------Vector: Member Functions (Arithmetic) -------------------------- */
+
+template <typename Data>
+Data Vector<Data>::Sum() const noexcept requires std::is_arithmetic_v<Data>
+{
+    return ArraySum(Elements, size);
+}
+
+template <typename Data>
+Data Vector<Data>::Min() const requires std::is_arithmetic_v<Data>
+{
+    return MinMax().first;
+}
+
+template <typename Data>
+Data Vector<Data>::Max() const requires std::is_arithmetic_v<Data>
+{
+    return MinMax().second;
+}
+
+template <typename Data>
+std::pair<Data, Data> Vector<Data>::MinMax() const requires std::is_arithmetic_v<Data>
+{
+    if(size == 0)
+        throw std::length_error("Length Error Exception from Vector: It is Empty\n");
+
+    // Minimo e massimo nella stessa passata: gli elementi vengono letti una volta sola
+    std::pair<Data, Data> result;
+    ArrayMinMax(Elements, size, result.first, result.second);
+
+    return result;
+}
+
+template <typename Data>
+Data Vector<Data>::Dot(const Vector &vec) const requires std::is_arithmetic_v<Data>
+{
+    if(size != vec.size)
+        throw std::length_error("Length Error Exception from Vector: Sizes Differ\n");
+
+    return ArrayDot(Elements, vec.Elements, size);
+}
+
+template <typename Data>
+void Vector<Data>::Scale(const Data &factor) noexcept requires std::is_arithmetic_v<Data>
+{
+    ArrayScale(Elements, size, factor);
+}
+
+template <typename Data>
+void Vector<Data>::Add(const Vector &vec) requires std::is_arithmetic_v<Data>
+{
+    if(size != vec.size)
+        throw std::length_error("Length Error Exception from Vector: Sizes Differ\n");
+
+    ArrayAdd(Elements, vec.Elements, size);
+}
+
+template <typename Data>
+void Vector<Data>::Clamp(const Data &lo, const Data &hi) requires std::is_arithmetic_v<Data>
+{
+    if(hi < lo)
+        throw std::out_of_range("Out Of Range Exception from Vector: Empty Interval\n");
+
+    ArrayClamp(Elements, size, lo, hi);
+}
+
+/* ---------------------------Vector: Member Functions (Parallel) -------------------------- */
+
+template <typename Data>
+void Vector<Data>::ParallelMap(MapFun fun, Executor &exec)
+{
+    ulong chunks = ParallelChunks(exec);
+    ulong length = size;
+
+    exec.ParallelFor(chunks, [this, &fun, chunks, length] (ulong chunk) {
+        ulong last = length * (chunk + 1) / chunks;
+
+        for(ulong i = length * chunk / chunks; i < last; i++)
+            fun(Elements[i]);
+    });
+}
+
+template <typename Data>
+template <typename Accumulator>
+Accumulator Vector<Data>::ParallelFold(FoldFun<Accumulator> fun, CombineFun<Accumulator> combine, Accumulator identity, Executor &exec) const
+{
+    ulong chunks = ParallelChunks(exec);
+    ulong length = size;
+
+    // Un risultato parziale per blocco, combinati nell'ordine degli indici
+    Accumulator * partials = new Accumulator[chunks];
+
+    try
+    {
+        exec.ParallelFor(chunks, [this, &fun, &identity, partials, chunks, length] (ulong chunk) {
+            Accumulator acc = identity;
+            ulong last = length * (chunk + 1) / chunks;
+
+            for(ulong i = length * chunk / chunks; i < last; i++)
+                acc = fun(Elements[i], acc);
+
+            partials[chunk] = std::move(acc);
+        });
+    }
+    catch(...)
+    {
+        delete[] partials;
+        throw;
+    }
+
+    Accumulator result = std::move(partials[0]);
+
+    for(ulong i = 1; i < chunks; i++)
+        result = combine(result, partials[i]);
+
+    delete[] partials;
+
+    return result;
+}
+
+template <typename Data>
+bool Vector<Data>::ParallelExists(const Data &key, Executor &exec) const
+{
+    ulong chunks = ParallelChunks(exec);
+    ulong length = size;
+    std::atomic<bool> found = false;
+
+    // Ogni blocco e' scandito a pezzi di ParallelGrain elementi, fermandosi appena un altro lo trova
+    exec.ParallelFor(chunks, [this, &key, &found, chunks, length] (ulong chunk) {
+        ulong last = length * (chunk + 1) / chunks;
+
+        for(ulong i = length * chunk / chunks; i < last && !found.load(std::memory_order_relaxed); i += ParallelGrain)
+        {
+            ulong piece = std::min(ParallelGrain, last - i);
+
+            if(LinearFind(Elements + i, piece, key) != piece)
+                found.store(true, std::memory_order_relaxed);
+        }
+    });
+
+    return found.load();
+}
+
+template <typename Data>
+ulong Vector<Data>::ParallelChunks(const Executor &exec) const noexcept
+{
+    // Qualche blocco in piu' dei thread, per bilanciare il carico
+    return std::max(std::min(4 * exec.Threads(), size / ParallelGrain), 1UL);
+}
+
 /* ---------------------------Vector: Member Functions (Resize) -------------------------- */
 
 template <typename Data>
@@ -264,6 +437,235 @@ SortableVector<Data> & SortableVector<Data>::operator=(SortableVector<Data> &&so
     return *this;
 }
 
+/* ---------------------------SortableVector: Specific member function (inherited from SortableLinearContainer)-------------------------- */
+
+// Ordinamento direttamente su Elements, senza passare per operator[] virtuale
+template <typename Data>
+void SortableVector<Data>::Sort() noexcept
+{
+    Executor * exec;
+
+    try
+    {
+        exec = &Executor::Default();
+    }
+    catch(...)
+    {
+        // Executor non avviato (thread non creati): heapsort in sequenza, che non alloca nulla
+        SortHeap(this->Elements, size, std::less<Data>());
+        return;
+    }
+
+    Sort(*exec);
+}
+
+template <typename Data>
+void SortableVector<Data>::Sort(Executor &exec) noexcept
+{
+    ParallelSort(this->Elements, size, exec);
+}
+
+template <typename Data>
+void SortableVector<Data>::StableSort()
+{
+    TimSort(this->Elements, size);
+}
+
+/* ---------------------------SortableVector: Specific member functions-------------------------- */
+
+template <typename Data>
+const Data & SortableVector<Data>::NthElement(ulong rank)
+{
+    if(rank >= size)
+        throw std::out_of_range("Out Of Range Exception from SortableVector");
+
+    SelectRange(0, size - 1, rank, 2 * std::bit_width(size));
+
+    return this->Elements[rank];
+}
+
+// Selezione dell'ultimo dei primi k, poi quicksort solo su quelli: O(n + k log k)
+template <typename Data>
+void SortableVector<Data>::PartialSort(ulong count)
+{
+    if(count > size)
+        throw std::out_of_range("Out Of Range Exception from SortableVector");
+
+    if(count == 0)
+        return;
+
+    if(count < size)
+        SelectRange(0, size - 1, count - 1, 2 * std::bit_width(size));
+
+    ParallelSort(this->Elements, count);
+}
+
+template <typename Data>
+Vector<Data> SortableVector<Data>::Percentiles(const LinearContainer<double> &percentiles)
+{
+    if(size == 0)
+        throw std::length_error("Length Exception: SortableVector is empty");
+
+    ulong count = percentiles.Size();
+
+    // Tutto in Vector: se la copia di un Data lancia non resta memoria da liberare a mano
+    Vector<Data> result(count);
+
+    if(count == 0)
+        return result;
+
+    Vector<ulong> ranks(count);
+    Vector<ulong> sorted(count);
+
+    // Nearest rank: il piu' piccolo elemento che ha almeno il p% dei valori minori o uguali
+    for(ulong i = 0; i < count; i++)
+    {
+        double percentile = percentiles[i];
+
+        if(!(percentile >= 0.0 && percentile <= 100.0))
+            throw std::out_of_range("Out Of Range Exception from SortableVector: percentile outside [0, 100]");
+
+        // Prima il prodotto, poi la divisione: 99 * 1000 / 100 e' esattamente 990, 99 / 100 * 1000 no
+        double position = std::ceil(percentile * static_cast<double>(size) / 100.0);
+        ranks[i] = sorted[i] = (position < 1.0) ? 0 : std::min(static_cast<ulong>(position) - 1, size - 1);
+    }
+
+    ulong * first = &sorted[0];
+    std::sort(first, first + count);
+    ulong unique = std::unique(first, first + count) - first;
+
+    MultiSelect(0, size, first, unique);
+
+    for(ulong i = 0; i < count; i++)
+        result[i] = this->Elements[ranks[i]];
+
+    return result;
+}
+
+template <typename Data>
+Vector<Data> SortableVector<Data>::Percentiles(std::initializer_list<double> percentiles)
+{
+    Vector<double> vec(percentiles.size());
+    ulong i = 0;
+
+    for(double percentile : percentiles)
+        vec[i++] = percentile;
+
+    return Percentiles(vec);
+}
+
+/* ---------------------------SortableVector: Auxiliary functions-------------------------- */
+
+// Floyd-Rivest: sopra SelectSample elementi il pivot viene prima selezionato, ricorsivamente, in un
+// campione di circa n^(2/3) elementi attorno alla posizione attesa del rango, cosi' la partizione
+// lo lascia quasi sempre vicino a rank e l'intervallo si riduce a poco piu' di n^(2/3). In media
+// n + min(k, n - k) + o(n) confronti; oltre depth giri si ordina con heapsort (O(n log n))
+template <typename Data>
+void SortableVector<Data>::SelectRange(ulong left, ulong right, ulong rank, ulong depth) noexcept
+{
+    Data * elements = this->Elements;
+    std::less<Data> comp;
+
+    while(right > left)
+    {
+        if(depth-- == 0)
+        {
+            SortHeap(elements + left, right - left + 1, comp);
+            return;
+        }
+
+        if(right - left > SelectSample)
+        {
+            double n = static_cast<double>(right - left + 1);
+            double i = static_cast<double>(rank - left + 1);
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2.0 * z / 3.0);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1.0 : 1.0);
+
+            double low = static_cast<double>(rank) - i * s / n + sd;
+            double high = static_cast<double>(rank) + (n - i) * s / n + sd;
+
+            ulong sampleLeft = std::max(left, static_cast<ulong>(std::max(low, 0.0)));
+            ulong sampleRight = std::min(right, static_cast<ulong>(std::max(high, 0.0)));
+
+            SelectRange(sampleLeft, sampleRight, rank, depth);
+        }
+
+        // Partizione attorno a t = elements[rank], che resta fermo durante la scansione: in left se
+        // elements[right] e' maggiore, altrimenti in right (lo scambio e' il primo del ciclo classico)
+        std::swap(elements[left], elements[rank]);
+        ulong at = left;
+
+        if(!comp(elements[left], elements[right]))
+        {
+            std::swap(elements[left], elements[right]);
+            at = right;
+        }
+
+        // Copia locale solo se non puo' lanciare, altrimenti il riferimento all'elemento fermo
+        using Pivot = std::conditional_t<std::is_nothrow_copy_constructible_v<Data>, const Data, const Data &>;
+        Pivot pivot = elements[at];
+        ulong i = left + 1, j = right - 1;
+
+        while(comp(elements[i], pivot))
+            i++;
+        while(comp(pivot, elements[j]))
+            j--;
+
+        while(i < j)
+        {
+            std::swap(elements[i], elements[j]);
+            i++;
+            j--;
+
+            while(comp(elements[i], pivot))
+                i++;
+            while(comp(pivot, elements[j]))
+                j--;
+        }
+
+        // Il pivot torna nella sua posizione definitiva j
+        if(at == left)
+            std::swap(elements[left], elements[j]);
+        else
+        {
+            j++;
+            std::swap(elements[j], elements[right]);
+        }
+
+        if(j == rank)
+            return;
+
+        if(j < rank)
+            left = j + 1;
+        else
+            right = j - 1;
+    }
+}
+
+// Il rango mediano divide l'array in due parti indipendenti, ognuna con i propri ranghi:
+// O(n log m) per m ranghi invece di m selezioni su tutto l'array
+template <typename Data>
+void SortableVector<Data>::MultiSelect(ulong left, ulong right, const ulong * ranks, ulong count) noexcept
+{
+    if(count == 0 || right - left < 2)
+        return;
+
+    if(right - left <= 16)
+    {
+        SortInsertion(this->Elements + left, right - left, std::less<Data>());
+        return;
+    }
+
+    ulong mid = count / 2;
+    ulong rank = ranks[mid];
+
+    SelectRange(left, right - 1, rank, 2 * std::bit_width(right - left));
+
+    MultiSelect(left, rank, ranks, mid);
+    MultiSelect(rank + 1, right, ranks + mid + 1, count - mid - 1);
+}
+
 /* ************************************************************************** */
 
 }
\ No newline at end of file
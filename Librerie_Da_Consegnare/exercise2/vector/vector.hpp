@@ -4,7 +4,19 @@
 
 /* ************************************************************************** */
 
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+/* ************************************************************************** */
+
 #include "../container/linear.hpp"
+#include "../simd/simd.hpp"
+#include "../parallel/executor.hpp"
+#include "../parallel/parallelsort.hpp"
+#include "../sort/timsort.hpp"
 
 /* ************************************************************************** */
 
@@ -89,6 +101,53 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions
+
+  ulong Find(const Data &) const noexcept; // Position of the first occurrence (Size() when not found)
+  ulong Count(const Data &) const noexcept; // Number of occurrences
+
+  /* ************************************************************************ */
+
+  // Specific member functions (arithmetic types only; floating point reductions are not summed in
+  // sequential order, so they may differ in the last bits from a Fold over the same elements)
+
+  Data Sum() const noexcept requires std::is_arithmetic_v<Data>; // (zero when empty)
+  Data Min() const requires std::is_arithmetic_v<Data>; // (must throw std::length_error when empty)
+  Data Max() const requires std::is_arithmetic_v<Data>; // (must throw std::length_error when empty)
+  std::pair<Data, Data> MinMax() const requires std::is_arithmetic_v<Data>; // (must throw std::length_error when empty)
+  Data Dot(const Vector &) const requires std::is_arithmetic_v<Data>; // (must throw std::length_error when the sizes differ)
+
+  void Scale(const Data &) noexcept requires std::is_arithmetic_v<Data>; // Every element multiplied by the factor
+  void Add(const Vector &) requires std::is_arithmetic_v<Data>; // Elementwise sum (must throw std::length_error when the sizes differ)
+  void Clamp(const Data &, const Data &) requires std::is_arithmetic_v<Data>; // Elements restricted to [lo, hi] (must throw std::out_of_range when lo > hi)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (parallel versions; the elements are split in contiguous chunks,
+  // one task each, and small vectors are processed on the calling thread)
+
+  using typename MappableContainer<Data>::MapFun;
+  void ParallelMap(MapFun, Executor & = Executor::Default()); // (the function is called concurrently on distinct elements)
+
+  template <typename Accumulator>
+  using FoldFun = typename TraversableContainer<Data>::FoldFun<Accumulator>;
+
+  template <typename Accumulator>
+  using CombineFun = std::function<Accumulator(const Accumulator &, const Accumulator &)>;
+
+  template <typename Accumulator>
+  Accumulator ParallelFold(FoldFun<Accumulator>, CombineFun<Accumulator>, Accumulator, Executor & = Executor::Default()) const; // (every chunk starts from the identity; partial results are combined in index order)
+
+  bool ParallelExists(const Data &, Executor & = Executor::Default()) const;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  inline bool Exists(const Data &) const noexcept override; // Override TestableContainer member
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ResizableContainer)
 
   void Resize(const ulong) override; // Override ResizableContainer member
@@ -103,6 +162,10 @@ protected:
 
   // Auxiliary functions, if necessary!
 
+  static constexpr ulong ParallelGrain = 1UL << 14; // Minimum number of elements for a task
+
+  ulong ParallelChunks(const Executor &) const noexcept;
+
 };
 
 /* ************************************************************************** */
@@ -153,9 +216,34 @@ public:
   // Move assignment
   SortableVector & operator=(SortableVector &&) noexcept;
 
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from SortableLinearContainer)
+
+  void Sort() noexcept override; // Override SortableLinearContainer member (parallel quicksort on the default executor, ordered by operator<; sequential heapsort if the executor cannot be started; not stable, use StableSort for that)
+
+  void Sort(Executor &) noexcept; // (parallel quicksort on a given executor, ordered by operator<; a part whose task cannot be spawned is sorted sequentially; not stable, use StableSort for that)
+
+  void StableSort(); // Adaptive stable sort (TimSort): equal elements keep their order, close to O(n) on nearly sorted data (may throw std::bad_alloc for the merge buffer)
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const Data & NthElement(ulong); // Moves the element of the given rank (from 0, ascending) to its position, the smaller ones before it and the greater ones after (must throw std::out_of_range when out of range)
+  void PartialSort(ulong); // The given number of smallest elements sorted at the front, the others after them in any order (must throw std::out_of_range when greater than the size)
+
+  Vector<Data> Percentiles(const LinearContainer<double> &); // Nearest-rank percentiles in [0, 100], each moved to its position as by NthElement (must throw std::length_error when empty, std::out_of_range for a percentile outside [0, 100])
+  Vector<Data> Percentiles(std::initializer_list<double>);
+
 protected:
 
-  // Auxiliary functions, if necessary!
+  // Auxiliary functions
+
+  static constexpr ulong SelectSample = 600; // Ranges above this size choose the pivots on a sample (Floyd-Rivest)
+
+  void SelectRange(ulong, ulong, ulong, ulong) noexcept; // Floyd-Rivest select of a rank in [left, right], heapsort when too deep
+  void MultiSelect(ulong, ulong, const ulong *, ulong) noexcept; // Every (sorted) rank of the array in [left, right)
 
 };
 
@@ -0,0 +1,20 @@
+#ifndef __MYCHECK_H__
+#define __MYCHECK_H__
+
+#include <iostream>
+#include <string>
+
+/* ************************************************************************** */
+
+// Generic check for the member functions not covered by zlasdtest!
+
+inline void Check(uint & testnum, uint & testerr, bool tst, const std::string & msg) {
+  testnum++;
+  std::cout << " " << testnum << " (" << testerr << ") " << msg << ": ";
+  std::cout << (tst ? "Correct" : "Error") << "!" << std::endl;
+  testerr += (1 - (uint) tst);
+}
+
+/* ************************************************************************** */
+
+#endif // __MYCHECK_H__
@@ -0,0 +1,903 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <set>
+
+/* ************************************************************************** */
+
+#include "../../zlasdtest/container/container.hpp"
+
+#include "../check.hpp"
+
+/* ************************************************************************** */
+
+#include "../../heap/vec/heapvec.hpp"
+#include "../../pq/heap/pqheap.hpp"
+#include "../../heap/topk/topk.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Tipi e funzioni di supporto: linkage interno, cosi' non si scontrano con quelli degli altri file di test
+namespace {
+
+void myheap_kth(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap KthLargest tests: ----------------------" << endl;
+
+        // HeapVec con duplicati: confronto con un std::vector ordinato
+        {
+            lasd::Vector<int> vec(200);
+            std::vector<int> ref;
+
+            for(ulong i = 0; i < 200; i++)
+            {
+                vec[i] = static_cast<int>((i * 7919) % 150);
+                ref.push_back(vec[i]);
+            }
+
+            lasd::HeapVec<int> heap(vec);
+            lasd::HeapVec<int> copy(heap);
+            std::sort(ref.begin(), ref.end(), std::greater<int>());
+
+            bool correct = true;
+            for(ulong k = 0; k < 200; k++)
+                correct = correct && heap.KthLargest(k) == ref[k];
+
+            Check(loctestnum, loctesterr, correct, "HeapVec: KthLargest on every rank");
+            Check(loctestnum, loctesterr, heap == copy && heap.IsHeap(), "HeapVec: the heap is left untouched");
+
+            bool thrown = false;
+            try { heap.KthLargest(200); } catch(const std::out_of_range &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "HeapVec: KthLargest(Size()) throws out_of_range");
+        }
+
+        // HeapVec vuoto
+        {
+            lasd::HeapVec<string> heap;
+
+            bool thrown = false;
+            try { heap.KthLargest(0); } catch(const std::out_of_range &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "HeapVec: KthLargest(0) on the empty heap throws out_of_range");
+        }
+
+        // PQHeap: la capacita' supera la dimensione
+        {
+            lasd::PQHeap<string> pq;
+
+            for(string str : {"delta", "alfa", "echo", "charlie", "bravo"})
+                pq.Insert(str);
+
+            Check(loctestnum, loctesterr, pq.KthLargest(0) == "echo" && pq.KthLargest(4) == "alfa", "PQHeap: KthLargest(0) and KthLargest(4)");
+            Check(loctestnum, loctesterr, pq.KthLargest(2) == "charlie", "PQHeap: KthLargest(2) is \"charlie\"");
+
+            pq.RemoveTip();
+            Check(loctestnum, loctesterr, pq.KthLargest(0) == "delta" && pq.Size() == 4, "PQHeap: KthLargest after RemoveTip");
+
+            bool thrown = false;
+            try { pq.KthLargest(4); } catch(const std::out_of_range &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "PQHeap: KthLargest(Size()) throws out_of_range");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap KthLargest tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+void myheap_search(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap search tests: ----------------------" << endl;
+
+        {
+            lasd::Vector<int> vec(100);
+
+            for(ulong i = 0; i < 100; i++)
+                vec[i] = static_cast<int>(i % 10);
+
+            lasd::HeapVec<int> heap(vec);
+
+            Check(loctestnum, loctesterr, heap.Exists(9) && !heap.Exists(10), "HeapVec: Exists");
+            Check(loctestnum, loctesterr, heap.Count(3) == 10 && heap.Count(-1) == 0, "HeapVec: Count");
+            Check(loctestnum, loctesterr, heap.Find(9) == 0 && heap.Find(10) == 100, "HeapVec: Find (the maximum is the root)");
+        }
+
+        // Heapify parallelo: sottoalberi costruiti come task separati
+        {
+            lasd::Executor exec(3);
+            lasd::Vector<long> vec(100000);
+            std::vector<long> ref(vec.Size());
+
+            lasd::HeapVec<long> heap(vec);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                heap[i] = ref[i] = static_cast<long>((i * 2654435761UL) % 100003);
+
+            heap.Heapify(exec);
+
+            std::vector<long> contents(heap.Size());
+
+            for(ulong i = 0; i < heap.Size(); i++)
+                contents[i] = heap[i];
+
+            std::sort(ref.begin(), ref.end());
+            std::sort(contents.begin(), contents.end());
+
+            Check(loctestnum, loctesterr, heap.IsHeap() && contents == ref, "HeapVec: Heapify on 4 threads");
+        }
+
+        // PQHeap: le celle libere oltre la dimensione non vanno considerate
+        {
+            lasd::PQHeap<double> pq;
+
+            for(int i = 0; i < 40; i++)
+                pq.Insert(i * 0.5);
+
+            for(int i = 0; i < 30; i++)
+                pq.RemoveTip();
+
+            Check(loctestnum, loctesterr, pq.Exists(4.5) && !pq.Exists(5.0), "PQHeap: Exists after RemoveTip");
+            Check(loctestnum, loctesterr, pq.Count(0.0) == 1 && pq.Find(19.5) == pq.Size(), "PQHeap: Count/Find ignore the free cells");
+
+            lasd::Executor exec(2);
+
+            Check(loctestnum, loctesterr, pq.ParallelExists(4.5, exec) && !pq.ParallelExists(19.5, exec), "PQHeap: ParallelExists ignores the free cells");
+            Check(loctestnum, loctesterr,
+                  pq.ParallelFold<double>([] (const double &dat, const double &acc) { return acc + dat; },
+                                          [] (const double &left, const double &right) { return left + right; }, 0.0, exec) == 22.5,
+                  "PQHeap: ParallelFold");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap search tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Heap d-ario: costruzione, ordinamento, KthLargest e coda di priorita' confrontati con std::sort
+template <ulong Arity>
+void ArityChecks(uint &loctestnum, uint &loctesterr)
+{
+    string name = to_string(Arity) + "-ary ";
+    bool built = true, sorted = true, kth = true, drained = true;
+
+    for(ulong length : {0UL, 1UL, 2UL, Arity + 1, 100UL, 5000UL})
+    {
+        lasd::Vector<long> vec(length);
+        std::vector<long> ref(length);
+
+        for(ulong i = 0; i < length; i++)
+            vec[i] = ref[i] = static_cast<long>((i * 2654435761UL) % 1009);
+
+        std::sort(ref.begin(), ref.end());
+
+        lasd::HeapVec<long, Arity> heap(vec);
+        built = built && heap.IsHeap() && heap.Size() == length;
+
+        for(ulong k = 0; k < length; k += 1 + length / 10)
+            kth = kth && heap.KthLargest(k) == ref[length - 1 - k];
+
+        heap.Sort();
+
+        for(ulong i = 0; i < length; i++)
+            sorted = sorted && heap[i] == ref[i];
+
+        lasd::PQHeap<long, Arity> pq;
+
+        for(ulong i = 0; i < length; i++)
+            pq.Insert(vec[i]);
+
+        for(ulong i = length; i > 0; i--)
+            drained = drained && pq.TipNRemove() == ref[i - 1];
+
+        drained = drained && pq.Empty();
+    }
+
+    Check(loctestnum, loctesterr, built, name + "HeapVec: construction gives a heap");
+    Check(loctestnum, loctesterr, kth, name + "HeapVec: KthLargest");
+    Check(loctestnum, loctesterr, sorted, name + "HeapVec: Sort");
+    Check(loctestnum, loctesterr, drained, name + "PQHeap: Insert/TipNRemove in order");
+}
+
+void myheap_arity(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap arity tests: ----------------------" << endl;
+
+        ArityChecks<2>(loctestnum, loctesterr);
+        ArityChecks<3>(loctestnum, loctesterr);
+        ArityChecks<4>(loctestnum, loctesterr);
+        ArityChecks<8>(loctestnum, loctesterr);
+
+        // Change e Heapify parallelo con figli su piu' livelli
+        {
+            lasd::PQHeap<int, 4> pq;
+
+            for(int i = 0; i < 200; i++)
+                pq.Insert(i);
+
+            pq.Change(150, 1000);
+            Check(loctestnum, loctesterr, pq.Tip() == 1000, "4-ary PQHeap: Change up to the root");
+
+            pq.Change(0, -1);
+            Check(loctestnum, loctesterr, pq.Tip() == 199 && pq.KthLargest(pq.Size() - 1) == -1, "4-ary PQHeap: Change of the root down");
+
+            lasd::Executor exec(3);
+            lasd::Vector<long> vec(100000);
+            lasd::HeapVec<long, 8> heap(vec);
+
+            for(ulong i = 0; i < heap.Size(); i++)
+                heap[i] = static_cast<long>((i * 2654435761UL) % 100003);
+
+            heap.Heapify(exec);
+            Check(loctestnum, loctesterr, heap.IsHeap(), "8-ary HeapVec: Heapify on 4 threads");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap arity tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Intero che conta i confronti eseguiti su di lui
+struct Counted {
+
+    static inline ulong comparisons = 0;
+
+    long value = 0;
+
+    Counted() = default;
+    Counted(long val) : value(val) {}
+
+    bool operator<(const Counted &other) const noexcept { comparisons++; return value < other.value; }
+    bool operator>(const Counted &other) const noexcept { comparisons++; return value > other.value; }
+    bool operator==(const Counted &other) const noexcept { return value == other.value; }
+    bool operator!=(const Counted &other) const noexcept { return value != other.value; }
+
+};
+
+void myheap_sift(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap sift tests: ----------------------" << endl;
+
+        // HeapSort con il sift di Floyd: circa n log n confronti invece di 2 n log n
+        {
+            const ulong length = 1UL << 14;
+            lasd::Vector<Counted> vec(length);
+
+            for(ulong i = 0; i < length; i++)
+                vec[i] = Counted(static_cast<long>((i * 2654435761UL) % 1000003));
+
+            lasd::HeapVec<Counted> heap(vec);
+
+            Counted::comparisons = 0;
+            heap.Sort();
+
+            bool sorted = true;
+
+            for(ulong i = 1; i < length; i++)
+                sorted = sorted && heap[i - 1].value <= heap[i].value;
+
+            Check(loctestnum, loctesterr, sorted, "HeapVec<Counted>: Sort");
+            Check(loctestnum, loctesterr, Counted::comparisons < 13 * length * 14 / 10, "HeapVec<Counted>: Sort uses less than 1.3 n log n comparisons");
+        }
+
+        // RemoveTip: stesso risultato, meno confronti della discesa classica (2 per livello)
+        {
+            const ulong length = 1UL << 12;
+            lasd::PQHeap<Counted> pq;
+
+            for(ulong i = 0; i < length; i++)
+                pq.Insert(Counted(static_cast<long>((i * 7919) % 4099)));
+
+            Counted::comparisons = 0;
+
+            bool ordered = true;
+            long last = pq.Tip().value;
+
+            while(!pq.Empty())
+            {
+                ordered = ordered && pq.Tip().value <= last;
+                last = pq.TipNRemove().value;
+            }
+
+            Check(loctestnum, loctesterr, ordered, "PQHeap<Counted>: TipNRemove in order");
+            Check(loctestnum, loctesterr, Counted::comparisons < 13 * length * 12 / 10, "PQHeap<Counted>: RemoveTip uses less than 1.3 log n comparisons each");
+        }
+
+        // Change per spostamento: il confronto avviene prima che il valore venga spostato
+        {
+            lasd::PQHeap<string> pq;
+
+            for(string str : {"b", "d", "f", "h", "j", "l"})
+                pq.Insert(str);
+
+            ulong index = pq.Find("b");
+            string top = "z";
+            pq.Change(index, std::move(top));
+
+            Check(loctestnum, loctesterr, pq.Tip() == "z", "PQHeap<string>: Change by move up to the root");
+
+            string bottom = "a";
+            pq.Change(0, std::move(bottom));
+
+            Check(loctestnum, loctesterr, pq.Tip() == "l" && pq.KthLargest(pq.Size() - 1) == "a", "PQHeap<string>: Change by move of the root down");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap sift tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Ordina le stringhe per lunghezza
+struct ByLength {
+
+    bool operator()(const string &fst, const string &snd) const noexcept { return fst.size() < snd.size(); }
+
+};
+
+void myheap_compare(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap compare tests: ----------------------" << endl;
+
+        // Min-heap: la radice e' il minimo, Sort ordina in modo decrescente
+        {
+            const ulong length = 1000;
+            lasd::Vector<long> vec(length);
+            std::vector<long> ref(length);
+
+            for(ulong i = 0; i < length; i++)
+                vec[i] = ref[i] = static_cast<long>((i * 7919) % 1009) - 500;
+
+            std::sort(ref.begin(), ref.end());
+
+            lasd::MinHeapVec<long> heap(vec);
+
+            Check(loctestnum, loctesterr, heap.IsHeap() && heap.Front() == ref[0], "MinHeapVec<long>: Heapify puts the minimum on the root");
+            Check(loctestnum, loctesterr, heap.KthLargest(0) == ref[0] && heap.KthLargest(10) == ref[10] && heap.KthLargest(length - 1) == ref[length - 1], "MinHeapVec<long>: KthLargest follows the ascending order");
+
+            heap.Sort();
+
+            bool sorted = true;
+
+            for(ulong i = 0; i < length; i++)
+                sorted = sorted && heap[i] == ref[length - 1 - i];
+
+            Check(loctestnum, loctesterr, sorted, "MinHeapVec<long>: Sort in descending order");
+
+            lasd::MinHeapVec<long, 4> heap4(vec);
+
+            Check(loctestnum, loctesterr, heap4.IsHeap() && heap4.Front() == ref[0], "MinHeapVec<long, 4>: Heapify puts the minimum on the root");
+        }
+
+        // MinPQHeap: estrazioni in ordine crescente, Change nei due versi
+        {
+            lasd::MinPQHeap<long> pq;
+            std::vector<long> ref;
+
+            for(long i = 0; i < 500; i++)
+            {
+                long val = (i * 104729) % 997;
+                pq.Insert(val);
+                ref.push_back(val);
+            }
+
+            std::sort(ref.begin(), ref.end());
+
+            Check(loctestnum, loctesterr, pq.Tip() == ref[0], "MinPQHeap<long>: Tip is the minimum");
+
+            ulong index = pq.Find(ref[100]);
+            pq.Change(index, -1);
+
+            Check(loctestnum, loctesterr, pq.Tip() == -1, "MinPQHeap<long>: Change to a smaller value goes up");
+
+            pq.Change(0, 5000);
+
+            Check(loctestnum, loctesterr, pq.Tip() == ref[0], "MinPQHeap<long>: Change of the tip to a greater value goes down");
+
+            bool ordered = true;
+            long last = pq.TipNRemove();
+
+            while(!pq.Empty())
+            {
+                long curr = pq.TipNRemove();
+                ordered = ordered && last <= curr;
+                last = curr;
+            }
+
+            Check(loctestnum, loctesterr, ordered && last == 5000, "MinPQHeap<long>: TipNRemove in ascending order");
+
+            lasd::MinPQHeap<string, 4> spq;
+
+            for(string str : {"m", "c", "x", "a", "q"})
+                spq.Insert(str);
+
+            Check(loctestnum, loctesterr, spq.TipNRemove() == "a" && spq.TipNRemove() == "c" && spq.Tip() == "m", "MinPQHeap<string, 4>: TipNRemove in ascending order");
+        }
+
+        // Comparatore definito dall'utente, senza costo di spazio
+        {
+            lasd::PQHeap<string, 2, ByLength> pq;
+
+            for(string str : {"ab", "abcde", "a", "abc"})
+                pq.Insert(str);
+
+            Check(loctestnum, loctesterr, pq.TipNRemove() == "abcde" && pq.Tip() == "abc", "PQHeap<string, 2, ByLength>: the longest string on the tip");
+
+            Check(loctestnum, loctesterr, sizeof(lasd::MinPQHeap<long>) == sizeof(lasd::PQHeap<long>) && sizeof(lasd::PQHeap<string, 2, ByLength>) == sizeof(lasd::PQHeap<string>), "PQHeap: a stateless comparator takes no space");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap compare tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Svuota la coda e confronta con i valori attesi ordinati
+template <typename PQType>
+bool Drains(PQType &pq, std::vector<long> ref)
+{
+    std::sort(ref.begin(), ref.end());
+
+    bool same = pq.Size() == ref.size();
+
+    for(ulong i = ref.size(); same && i > 0; i--)
+        same = pq.TipNRemove() == ref[i - 1];
+
+    return same && pq.Empty();
+}
+
+template <ulong Arity>
+void BatchChecks(uint &loctestnum, uint &loctesterr)
+{
+    string name = to_string(Arity) + "-ary PQHeap: ";
+    bool few = true, many = true, melded = true;
+
+    // Lotti piccoli (sift-up per elemento) e grandi (Heapify) rispetto alla coda
+    for(ulong length : {0UL, 1UL, 50UL, 3000UL})
+        for(ulong batch : {0UL, 1UL, 10UL, 4000UL})
+        {
+            lasd::Vector<long> old(length), add(batch);
+            std::vector<long> ref;
+
+            for(ulong i = 0; i < length; i++)
+                ref.push_back(old[i] = static_cast<long>((i * 2654435761UL) % 1009));
+            for(ulong i = 0; i < batch; i++)
+                ref.push_back(add[i] = static_cast<long>((i * 40503UL) % 2003) - 500);
+
+            lasd::PQHeap<long, Arity> pq(old);
+            pq.InsertAll(add);
+
+            if(batch * 3 > length)
+                many = many && Drains(pq, ref);
+            else
+                few = few && Drains(pq, ref);
+
+            lasd::PQHeap<long, Arity> fst(old), snd(add);
+            fst.Meld(std::move(snd));
+            melded = melded && snd.Empty() && Drains(fst, ref);
+
+            lasd::PQHeap<long, Arity> big(old), small(add);
+            small.Meld(std::move(big));
+            melded = melded && big.Empty() && Drains(small, ref);
+        }
+
+    Check(loctestnum, loctesterr, few, name + "InsertAll of a small batch");
+    Check(loctestnum, loctesterr, many, name + "InsertAll of a large batch");
+    Check(loctestnum, loctesterr, melded, name + "Meld in both directions");
+}
+
+void myheap_batch(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap batch tests: ----------------------" << endl;
+
+        BatchChecks<2>(loctestnum, loctesterr);
+        BatchChecks<4>(loctestnum, loctesterr);
+
+        // InsertAll per spostamento, MinPQHeap, Meld con se' stessa
+        {
+            lasd::Vector<string> vec(3);
+            vec[0] = "kilo";
+            vec[1] = "alfa";
+            vec[2] = "zulu";
+
+            lasd::MinPQHeap<string> pq;
+            pq.Insert("mike");
+            pq.InsertAll(std::move(vec));
+
+            Check(loctestnum, loctesterr, pq.Size() == 4 && pq.Tip() == "alfa" && vec[0].empty(), "MinPQHeap<string>: InsertAll by move");
+
+            pq.Meld(std::move(pq));
+            Check(loctestnum, loctesterr, pq.Size() == 4 && pq.TipNRemove() == "alfa" && pq.TipNRemove() == "kilo", "MinPQHeap<string>: Meld with itself does nothing");
+
+            // InsertAll con se' stessa raddoppia gli elementi
+            pq.InsertAll(pq);
+            Check(loctestnum, loctesterr, pq.Size() == 4 && pq.TipNRemove() == "mike" && pq.TipNRemove() == "mike" && pq.Tip() == "zulu", "MinPQHeap<string>: InsertAll of itself by copy");
+            pq.RemoveTip();
+            pq.Insert("mike");
+
+            lasd::MinPQHeap<string> other;
+            other.Meld(std::move(pq));
+            other.Insert("bravo");
+            Check(loctestnum, loctesterr, pq.Empty() && other.Size() == 3 && other.Tip() == "bravo", "MinPQHeap<string>: Meld into an empty queue");
+
+            pq.Insert("x");
+            Check(loctestnum, loctesterr, pq.Tip() == "x", "MinPQHeap<string>: the melded queue is usable");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap batch tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Confronto con un multiset dei valori vivi; le posizioni contano anche i cancellati in sospeso
+bool SameAs(const lasd::PQHeap<long> &pq, const multiset<long> &ref)
+{
+    return pq.Size() - pq.Cancelled() == ref.size() && (ref.empty() || pq.Tip() == *ref.rbegin());
+}
+
+bool RandomRemove(bool lazy)
+{
+    lasd::PQHeap<long> pq;
+    multiset<long> ref;
+    ulong seed = lazy ? 2024 : 1999;
+    bool same = true;
+
+    for(ulong step = 0; step < 8000; step++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ulong op = (seed >> 60) % 5;
+        long value = static_cast<long>((seed >> 33) % 500);
+
+        if(op <= 1 || ref.empty())
+        {
+            pq.Insert(value);
+            ref.insert(value);
+        }
+        else if(op == 2 || op == 3)
+        {
+            // Un 30-40% di cancellazioni, come in una coda di job
+            auto it = ref.lower_bound(value);
+            it = (it == ref.end()) ? ref.begin() : it;
+
+            if(lazy)
+                pq.Cancel(*it);
+            else
+                pq.Remove(pq.Find(*it));
+
+            ref.erase(it);
+        }
+        else
+        {
+            same = same && pq.TipNRemove() == *ref.rbegin();
+            ref.erase(std::prev(ref.end()));
+        }
+
+        same = same && (lazy || pq.Cancelled() == 0) && pq.Cancelled() * 4 <= pq.Size() + 4;
+
+        if(step % 41 == 0)
+            same = same && SameAs(pq, ref);
+    }
+
+    while(same && !ref.empty())
+    {
+        same = pq.TipNRemove() == *ref.rbegin();
+        ref.erase(std::prev(ref.end()));
+    }
+
+    return same && pq.Empty() && pq.Cancelled() == 0;
+}
+
+void myheap_remove(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap remove tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomRemove(false), "PQHeap: random Insert/Remove/TipNRemove");
+        Check(loctestnum, loctesterr, RandomRemove(true), "PQHeap: random Insert/Cancel/TipNRemove");
+
+        // Remove per posizione: l'ultimo elemento sale o scende
+        {
+            lasd::PQHeap<long, 4> pq;
+
+            for(long i = 0; i < 100; i++)
+                pq.Insert((i * 37) % 101);
+
+            pq.Remove(0);
+            Check(loctestnum, loctesterr, pq.Size() == 99 && pq.Tip() == 99 && !pq.Exists(100), "4-ary PQHeap: Remove of the tip");
+
+            pq.Remove(pq.Size() - 1);
+            pq.Remove(pq.Find(50));
+            pq.Remove(pq.Find(0));
+            Check(loctestnum, loctesterr, pq.Size() == 96 && !pq.Exists(50) && !pq.Exists(0) && pq.Tip() == 99, "4-ary PQHeap: Remove of inner elements and of the last one");
+
+            bool ordered = true;
+            long last = pq.TipNRemove();
+
+            while(!pq.Empty())
+            {
+                long curr = pq.TipNRemove();
+                ordered = ordered && curr <= last && curr != 50;
+                last = curr;
+            }
+
+            Check(loctestnum, loctesterr, ordered, "4-ary PQHeap: TipNRemove in order after Remove");
+
+            try
+            {
+                pq.Remove(0);
+                Check(loctestnum, loctesterr, false, "Remove from an empty PQHeap must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "Remove from an empty PQHeap throws out_of_range");
+            }
+        }
+
+        // Cancel: la cima resta viva, compattazione, copia, Meld
+        {
+            lasd::MinPQHeap<string> pq;
+
+            for(string s : {"delta", "alfa", "echo", "bravo", "charlie", "foxtrot", "golf", "hotel"})
+                pq.Insert(s);
+
+            pq.Cancel("alfa");
+            Check(loctestnum, loctesterr, pq.Tip() == "bravo" && pq.Cancelled() == 0 && pq.Size() == 7, "MinPQHeap<string>: Cancel of the tip drops it at once");
+
+            pq.Cancel("charlie");
+            Check(loctestnum, loctesterr, pq.Tip() == "bravo" && pq.Cancelled() == 1 && pq.Size() == 7, "MinPQHeap<string>: Cancel of an inner element is lazy");
+
+            lasd::MinPQHeap<string> copy(pq);
+
+            Check(loctestnum, loctesterr, pq.TipNRemove() == "bravo" && pq.Tip() == "delta" && pq.Cancelled() == 0, "MinPQHeap<string>: a cancelled element reaching the tip leaves");
+
+            pq.Cancel("golf");
+            pq.Cancel("echo");
+            Check(loctestnum, loctesterr, pq.Cancelled() == 0 && pq.Size() == 3 && pq.Tip() == "delta" && !pq.Exists("golf"), "MinPQHeap<string>: compaction past a quarter of the elements");
+
+            Check(loctestnum, loctesterr, copy.Cancelled() == 1 && copy.TipNRemove() == "bravo" && copy.TipNRemove() == "delta", "MinPQHeap<string>: the copy keeps its own tombstones");
+
+            pq.Meld(std::move(copy));
+            Check(loctestnum, loctesterr, copy.Empty() && copy.Cancelled() == 0 && pq.Size() == 7, "MinPQHeap<string>: Meld");
+
+            string order;
+            while(!pq.Empty())
+                order += pq.TipNRemove()[0];
+
+            Check(loctestnum, loctesterr, order == "deffghh", "MinPQHeap<string>: TipNRemove skips the cancelled elements");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap remove tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// I k piu' grandi di un flusso pseudo-casuale con molti duplicati, confrontati con un std::vector ordinato
+template <ulong Arity>
+bool TopKStream(ulong length, ulong k, bool parallel)
+{
+    lasd::Vector<long> vec(length);
+    std::vector<long> ref(length);
+    ulong seed = 2024 + length + k;
+
+    for(ulong i = 0; i < length; i++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        vec[i] = ref[i] = static_cast<long>((seed >> 33) % (length / 2 + 1)) - static_cast<long>(length / 4);
+    }
+
+    std::sort(ref.begin(), ref.end(), std::greater<long>());
+    ref.resize(std::min(k, length));
+
+    lasd::TopK<long, Arity> topk(k);
+
+    if(parallel)
+        topk.PushAll(vec);
+    else
+        for(ulong i = 0; i < length; i++)
+            topk.Push(vec[i]);
+
+    lasd::SortableVector<long> result = topk.Result();
+    bool same = result.Size() == ref.size() && topk.Size() == ref.size();
+
+    for(ulong i = 0; same && i < ref.size(); i++)
+        same = result[i] == ref[i];
+
+    return same && (ref.empty() || topk.Threshold() == ref.back());
+}
+
+void myheap_topk(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyHeap TopK tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, TopKStream<2>(10000, 25, false) && TopKStream<2>(10, 25, false) && TopKStream<2>(25, 25, false), "TopK<long>: Push of a stream");
+        Check(loctestnum, loctesterr, TopKStream<4>(10000, 1, false) && TopKStream<4>(10000, 500, false), "4-ary TopK<long>: Push of a stream");
+        Check(loctestnum, loctesterr, TopKStream<2>(300000, 100, true) && TopKStream<4>(300000, 1000, true) && TopKStream<2>(100, 7, true), "TopK<long>: parallel PushAll of a vector");
+
+        // Costruzione da contenitore, comparatore invertito, Merge
+        {
+            lasd::Vector<string> vec(6);
+            vec[0] = "kilo";
+            vec[1] = "alfa";
+            vec[2] = "zulu";
+            vec[3] = "mike";
+            vec[4] = "bravo";
+            vec[5] = "echo";
+
+            lasd::BottomK<string> bottom(3, vec);
+            lasd::SortableVector<string> result = bottom.Result();
+
+            Check(loctestnum, loctesterr, bottom.K() == 3 && result.Size() == 3 && result[0] == "alfa" && result[1] == "bravo" && result[2] == "echo", "BottomK<string>: the smallest three from a container");
+
+            lasd::BottomK<string> other(3);
+            other.Push("able");
+            other.Push("delta");
+            bottom.Merge(std::move(other));
+            result = bottom.Result();
+
+            Check(loctestnum, loctesterr, other.Empty() && result[0] == "able" && result[1] == "alfa" && result[2] == "bravo", "BottomK<string>: Merge of two streams");
+        }
+
+        // Copia e spostamento, k = 0, Clear, eccezioni
+        {
+            lasd::TopK<int> topk(2);
+
+            for(int value : {5, 1, 9, 7})
+                topk.Push(value);
+
+            lasd::TopK<int> copy(topk);
+            Check(loctestnum, loctesterr, copy == topk && copy.Threshold() == 7, "Copy constructor");
+
+            copy.Push(8);
+            Check(loctestnum, loctesterr, copy != topk && copy.Threshold() == 8 && topk.Threshold() == 7, "The copy is independent");
+
+            lasd::TopK<int> moved(std::move(copy));
+            Check(loctestnum, loctesterr, copy.Empty() && moved.Size() == 2 && moved.K() == 2, "Move constructor");
+
+            moved.Clear();
+            moved.Push(3);
+            Check(loctestnum, loctesterr, moved.Size() == 1 && moved.K() == 2 && moved.Threshold() == 3, "Clear keeps k");
+
+            lasd::TopK<int> none(0);
+            none.Push(1);
+            Check(loctestnum, loctesterr, none.Empty() && none.Result().Empty(), "TopK with k = 0 keeps nothing");
+
+            try
+            {
+                none.Threshold();
+                Check(loctestnum, loctesterr, false, "Threshold of an empty TopK must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Threshold of an empty TopK throws length_error");
+            }
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyHeap TopK tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+}
+
+/* ************************************************************************** */
+
+void myheapext_test(uint &testnum, uint &testerr)
+{
+    myheap_kth(testnum, testerr);
+    myheap_search(testnum, testerr);
+    myheap_arity(testnum, testerr);
+    myheap_sift(testnum, testerr);
+    myheap_compare(testnum, testerr);
+    myheap_batch(testnum, testerr);
+    myheap_remove(testnum, testerr);
+    myheap_topk(testnum, testerr);
+}
@@ -0,0 +1,6 @@
+#ifndef __HEAPEXT_H__
+#define __HEAPEXT_H__
+
+void myheapext_test(unsigned int &, unsigned int &);
+
+#endif // __HEAPEXT_H__
@@ -0,0 +1,188 @@
+#include <iostream>
+#include <string>
+
+/* ************************************************************************** */
+
+#include "../../zlasdtest/container/container.hpp"
+
+#include "../check.hpp"
+
+/* ************************************************************************** */
+
+#include "../../map/hash/maphash.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+void mymaphash_int(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyMapHash<int, string> tests: ----------------------" << endl;
+
+        // Empty map
+        {
+            lasd::MapHash<int, string> map;
+
+            Empty(loctestnum, loctesterr, map, true);
+            Size(loctestnum, loctesterr, map, true, 0);
+            Check(loctestnum, loctesterr, !map.Exists(1), "Key 1 does not exist");
+            Check(loctestnum, loctesterr, !map.Remove(1), "Remove of the missing key 1 fails");
+
+            bool thrown = false;
+            try { map.Find(1); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Find of the missing key 1 throws length_error");
+        }
+
+        // InsertOrAssign, Find, operator[]
+        {
+            lasd::MapHash<int, string> map;
+
+            Check(loctestnum, loctesterr, map.InsertOrAssign(20, string("venti")), "InsertOrAssign(20) inserts");
+            Check(loctestnum, loctesterr, map.InsertOrAssign(10, string("dieci")), "InsertOrAssign(10) inserts");
+            Check(loctestnum, loctesterr, map.InsertOrAssign(30, string("trenta")), "InsertOrAssign(30) inserts");
+            Check(loctestnum, loctesterr, !map.InsertOrAssign(20, string("XX")), "InsertOrAssign(20) assigns");
+            Size(loctestnum, loctesterr, map, true, 3);
+
+            Check(loctestnum, loctesterr, map.Find(20) == "XX", "Find(20) is \"XX\"");
+            Check(loctestnum, loctesterr, map.Find(10) == "dieci", "Find(10) is \"dieci\"");
+
+            map[25] = "venticinque";
+            map[10] += "!";
+            Size(loctestnum, loctesterr, map, true, 4);
+            Check(loctestnum, loctesterr, map.Find(25) == "venticinque", "operator[] inserted key 25");
+            Check(loctestnum, loctesterr, map.Find(10) == "dieci!", "operator[] updated key 10");
+
+            int keys = 0;
+            map.Traverse([&keys](const int &key, const string &) { keys += key; });
+            Check(loctestnum, loctesterr, keys == 85, "Traverse visits every key once");
+
+            map.Map([](const int &, string &value) { value = value.substr(0, 1); });
+            Check(loctestnum, loctesterr, map.Find(30) == "t", "Map updates the values");
+
+            Check(loctestnum, loctesterr, map.Remove(20), "Remove(20) succeeds");
+            Check(loctestnum, loctesterr, !map.Exists(20), "Key 20 does not exist anymore");
+            Size(loctestnum, loctesterr, map, true, 3);
+        }
+
+        // Copy, move and comparison
+        {
+            lasd::MapHash<int, string> map;
+            for(int i = 0; i < 10; i++)
+                map.InsertOrAssign(i, to_string(i));
+
+            lasd::MapHash<int, string> copy(map);
+            Check(loctestnum, loctesterr, copy == map, "The copy is equal to the original");
+
+            copy[3] = "tre";
+            Check(loctestnum, loctesterr, copy != map, "A different value makes the maps different");
+
+            lasd::MapHash<int, string> moved(std::move(copy));
+            Check(loctestnum, loctesterr, moved.Find(3) == "tre", "The moved map keeps its values");
+            Empty(loctestnum, loctesterr, copy, true);
+
+            // La mappa spostata resta utilizzabile
+            lasd::MapHash<int, string> copyOfMoved(copy);
+            Check(loctestnum, loctesterr, !copy.Exists(3) && !copy.Remove(3) && copyOfMoved.Empty(), "A moved-from map finds nothing and can be copied");
+            Check(loctestnum, loctesterr, copy.InsertOrAssign(7, "sette") && copy.Find(7) == "sette", "InsertOrAssign on a moved-from map");
+
+            lasd::MapHash<int, string> other(std::move(copyOfMoved));
+            other[5] = "cinque";
+            Check(loctestnum, loctesterr, other.Size() == 1 && other.Exists(5), "operator[] on a moved-from map");
+
+            moved = map;
+            Check(loctestnum, loctesterr, moved == map, "Copy assignment");
+
+            moved.Clear();
+            Empty(loctestnum, loctesterr, moved, true);
+            moved[1] = "uno";
+            Size(loctestnum, loctesterr, moved, true, 1);
+        }
+
+        // Stress: keys inserted in scrambled order, half removed
+        {
+            lasd::MapHash<int, int> map;
+            bool ok = true;
+
+            for(int i = 0; i < 1000; i++)
+                map.InsertOrAssign((i * 7919) % 1000, 2 * ((i * 7919) % 1000));
+
+            for(int i = 0; i < 1000; i += 2)
+                ok &= map.Remove(i);
+
+            Size(loctestnum, loctesterr, map, true, 500);
+
+            for(int i = 0; i < 1000; i++)
+                ok &= (map.Exists(i) == (i % 2 == 1));
+
+            for(int i = 1; i < 1000; i += 2)
+                ok &= (map.Find(i) == 2 * i);
+
+            Check(loctestnum, loctesterr, ok, "Scrambled inserts and removals keep the map consistent");
+
+            for(int i = 1; i < 1000; i += 2)
+                ok &= map.Remove(i);
+
+            Empty(loctestnum, loctesterr, map, true);
+            Check(loctestnum, loctesterr, ok && !map.Exists(1), "The table shrinks back when emptied");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyMapHash<int, string> tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+void mymaphash_string(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyMapHash<string, double> tests: ----------------------" << endl;
+
+        lasd::MapHash<string, double> map;
+
+        map["b"] = 2.0;
+        map["a"] = 1.0;
+        map["c"] = 3.0;
+        map["a"] += 0.5;
+
+        Size(loctestnum, loctesterr, map, true, 3);
+        Check(loctestnum, loctesterr, map.Find("a") == 1.5, "Find(\"a\") is 1.5");
+        Check(loctestnum, loctesterr, !map.InsertOrAssign("c", 4.0), "InsertOrAssign(\"c\") assigns");
+        Check(loctestnum, loctesterr, map.Find("c") == 4.0, "Find(\"c\") is 4.0");
+        Check(loctestnum, loctesterr, map.Remove("a") && !map.Exists("a"), "Remove(\"a\")");
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyMapHash<string, double> tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+void mymaphash_test(uint &testnum, uint &testerr)
+{
+    mymaphash_int(testnum, testerr);
+    mymaphash_string(testnum, testerr);
+}
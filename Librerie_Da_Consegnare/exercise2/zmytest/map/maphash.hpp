@@ -0,0 +1,6 @@
+#ifndef __MAPHASH_H__
+#define __MAPHASH_H__
+
+void mymaphash_test(unsigned int &, unsigned int &);
+
+#endif // __MAPHASH_H__
@@ -0,0 +1,192 @@
+#include <iostream>
+#include <string>
+
+/* ************************************************************************** */
+
+#include "../../zlasdtest/container/container.hpp"
+
+#include "../check.hpp"
+
+/* ************************************************************************** */
+
+#include "../../map/vec/mapvec.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+void mymapvec_int(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyMapVec<int, string> tests: ----------------------" << endl;
+
+        // Empty map
+        {
+            lasd::MapVec<int, string> map;
+
+            Empty(loctestnum, loctesterr, map, true);
+            Size(loctestnum, loctesterr, map, true, 0);
+            Check(loctestnum, loctesterr, !map.Exists(1), "Key 1 does not exist");
+            Check(loctestnum, loctesterr, !map.Remove(1), "Remove of the missing key 1 fails");
+
+            bool thrown = false;
+            try { map.Find(1); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Find of the missing key 1 throws length_error");
+
+            thrown = false;
+            try { map.Successor(1); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Successor on the empty map throws length_error");
+        }
+
+        // InsertOrAssign, Find, operator[], Predecessor/Successor
+        {
+            lasd::MapVec<int, string> map;
+
+            Check(loctestnum, loctesterr, map.InsertOrAssign(20, string("venti")), "InsertOrAssign(20) inserts");
+            Check(loctestnum, loctesterr, map.InsertOrAssign(10, string("dieci")), "InsertOrAssign(10) inserts");
+            Check(loctestnum, loctesterr, map.InsertOrAssign(30, string("trenta")), "InsertOrAssign(30) inserts");
+            Check(loctestnum, loctesterr, !map.InsertOrAssign(20, string("XX")), "InsertOrAssign(20) assigns");
+            Size(loctestnum, loctesterr, map, true, 3);
+
+            Check(loctestnum, loctesterr, map.Find(20) == "XX", "Find(20) is \"XX\"");
+            Check(loctestnum, loctesterr, map.Find(10) == "dieci", "Find(10) is \"dieci\"");
+
+            map[25] = "venticinque";
+            map[10] += "!";
+            Size(loctestnum, loctesterr, map, true, 4);
+            Check(loctestnum, loctesterr, map.Find(25) == "venticinque", "operator[] inserted key 25");
+            Check(loctestnum, loctesterr, map.Find(10) == "dieci!", "operator[] updated key 10");
+
+            Check(loctestnum, loctesterr, map.Predecessor(25).key == 20, "Predecessor(25) is 20");
+            Check(loctestnum, loctesterr, map.Predecessor(26).value == "venticinque", "Predecessor(26) has value \"venticinque\"");
+            Check(loctestnum, loctesterr, map.Successor(25).key == 30, "Successor(25) is 30");
+            Check(loctestnum, loctesterr, map.Successor(0).key == 10, "Successor(0) is 10");
+
+            bool thrown = false;
+            try { map.Predecessor(10); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Predecessor(10) throws length_error");
+
+            thrown = false;
+            try { map.Successor(30); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Successor(30) throws length_error");
+
+            string keys = "";
+            map.Traverse([&keys](const int &key, const string &) { keys += to_string(key) + " "; });
+            Check(loctestnum, loctesterr, keys == "10 20 25 30 ", "Traverse visits the keys in ascending order");
+
+            map.Map([](const int &, string &value) { value = value.substr(0, 1); });
+            Check(loctestnum, loctesterr, map.Find(30) == "t", "Map updates the values");
+
+            Check(loctestnum, loctesterr, map.Remove(20), "Remove(20) succeeds");
+            Check(loctestnum, loctesterr, !map.Exists(20), "Key 20 does not exist anymore");
+            Size(loctestnum, loctesterr, map, true, 3);
+        }
+
+        // Copy, move and comparison
+        {
+            lasd::MapVec<int, string> map;
+            for(int i = 0; i < 10; i++)
+                map.InsertOrAssign(i, to_string(i));
+
+            lasd::MapVec<int, string> copy(map);
+            Check(loctestnum, loctesterr, copy == map, "The copy is equal to the original");
+
+            copy[3] = "tre";
+            Check(loctestnum, loctesterr, copy != map, "A different value makes the maps different");
+
+            lasd::MapVec<int, string> moved(std::move(copy));
+            Check(loctestnum, loctesterr, moved.Find(3) == "tre", "The moved map keeps its values");
+            Empty(loctestnum, loctesterr, copy, true);
+
+            moved = map;
+            Check(loctestnum, loctesterr, moved == map, "Copy assignment");
+
+            moved.Clear();
+            Empty(loctestnum, loctesterr, moved, true);
+            moved[1] = "uno";
+            Size(loctestnum, loctesterr, moved, true, 1);
+        }
+
+        // Stress: keys inserted in scrambled order, half removed
+        {
+            lasd::MapVec<int, int> map;
+            bool ok = true;
+
+            for(int i = 0; i < 1000; i++)
+                map.InsertOrAssign((i * 7919) % 1000, i);
+
+            for(int i = 0; i < 1000; i += 2)
+                ok &= map.Remove(i);
+
+            Size(loctestnum, loctesterr, map, true, 500);
+
+            for(int i = 0; i < 1000; i++)
+                ok &= (map.Exists(i) == (i % 2 == 1));
+
+            for(int i = 1; i < 999; i += 2)
+                ok &= (map.Successor(i).key == i + 2);
+
+            Check(loctestnum, loctesterr, ok, "Scrambled inserts and removals keep the map consistent");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyMapVec<int, string> tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+void mymapvec_string(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyMapVec<string, double> tests: ----------------------" << endl;
+
+        lasd::MapVec<string, double> map;
+
+        map["b"] = 2.0;
+        map["a"] = 1.0;
+        map["c"] = 3.0;
+        map["a"] += 0.5;
+
+        Size(loctestnum, loctesterr, map, true, 3);
+        Check(loctestnum, loctesterr, map.Find("a") == 1.5, "Find(\"a\") is 1.5");
+        Check(loctestnum, loctesterr, map.Predecessor("b").key == "a", "Predecessor(\"b\") is \"a\"");
+        Check(loctestnum, loctesterr, map.Successor("bb").key == "c", "Successor(\"bb\") is \"c\"");
+        Check(loctestnum, loctesterr, !map.InsertOrAssign("c", 4.0), "InsertOrAssign(\"c\") assigns");
+        Check(loctestnum, loctesterr, map.Find("c") == 4.0, "Find(\"c\") is 4.0");
+        Check(loctestnum, loctesterr, map.Remove("a") && !map.Exists("a"), "Remove(\"a\")");
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyMapVec<string, double> tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+void mymapvec_test(uint &testnum, uint &testerr)
+{
+    mymapvec_int(testnum, testerr);
+    mymapvec_string(testnum, testerr);
+}
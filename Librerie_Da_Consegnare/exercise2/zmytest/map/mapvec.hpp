@@ -0,0 +1,6 @@
+#ifndef __MAPVEC_H__
+#define __MAPVEC_H__
+
+void mymapvec_test(unsigned int &, unsigned int &);
+
+#endif // __MAPVEC_H__
@@ -0,0 +1,1116 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+
+/* ************************************************************************** */
+
+#include "../../zlasdtest/container/container.hpp"
+
+#include "../check.hpp"
+
+/* ************************************************************************** */
+
+#include "../../vector/vector.hpp"
+#include "../../pq/indexed/indexedpqheap.hpp"
+#include "../../pq/pairing/pqpairing.hpp"
+#include "../../pq/radix/pqradix.hpp"
+#include "../../pq/minmax/minmaxheap.hpp"
+#include "../../pq/stable/stablepqheap.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Tipi e funzioni di supporto: linkage interno, cosi' non si scontrano con quelli degli altri file di test
+namespace {
+
+using Graph = vector<vector<pair<ulong, long>>>; // Liste di adiacenza (nodo, peso)
+
+// Grafo casuale con 5 archi uscenti per nodo e pesi in [1, 100]
+Graph RandomGraph(ulong nodes, ulong seed)
+{
+    Graph graph(nodes);
+
+    for(ulong u = 0; u < nodes; u++)
+        for(ulong k = 0; k < 5; k++)
+        {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            graph[u].push_back({(seed >> 33) % nodes, static_cast<long>((seed >> 20) % 100) + 1});
+        }
+
+    return graph;
+}
+
+// Distanze dal nodo 0 (-1 se irraggiungibile), riferimento per i Dijkstra
+vector<long> BellmanFord(const Graph &graph)
+{
+    vector<long> dist(graph.size(), -1);
+    dist[0] = 0;
+
+    for(ulong round = 0; round < graph.size(); round++)
+        for(ulong u = 0; u < graph.size(); u++)
+            for(auto [v, w] : graph[u])
+                if(dist[u] >= 0 && (dist[v] < 0 || dist[u] + w < dist[v]))
+                    dist[v] = dist[u] + w;
+
+    return dist;
+}
+
+/* ************************************************************************** */
+
+// Confronto con una mappa handle -> valore: stessi handle, stessi valori, massimo in cima
+template <typename Data, ulong Arity>
+bool SameAs(const lasd::IndexedPQHeap<Data, Arity> &pq, const map<ulong, Data> &ref)
+{
+    if(pq.Size() != ref.size())
+        return false;
+
+    Data max {};
+
+    for(const auto &[handle, value] : ref)
+    {
+        if(!pq.Contains(handle) || pq[handle] != value)
+            return false;
+
+        max = (handle == ref.begin()->first || max < value) ? value : max;
+    }
+
+    return ref.empty() || pq.Tip() == max;
+}
+
+template <ulong Arity>
+bool RandomOperations()
+{
+    lasd::IndexedPQHeap<long, Arity> pq;
+    map<ulong, long> ref;
+    vector<ulong> live;
+    ulong seed = 12345;
+    bool same = true;
+
+    for(ulong step = 0; step < 5000; step++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ulong op = (seed >> 60) % 5;
+        long value = static_cast<long>((seed >> 33) % 1000);
+
+        if(op <= 1 || live.empty())
+        {
+            ulong handle = pq.Insert(value);
+            same = same && ref.count(handle) == 0;
+            ref[handle] = value;
+            live.push_back(handle);
+        }
+        else
+        {
+            ulong which = (seed >> 20) % live.size();
+            ulong handle = live[which];
+
+            if(op == 2)
+            {
+                pq.Change(handle, value);
+                ref[handle] = value;
+            }
+            else if(op == 3)
+            {
+                pq.Remove(handle);
+                ref.erase(handle);
+                live[which] = live.back();
+                live.pop_back();
+            }
+            else
+            {
+                ulong tip = pq.TipHandle();
+                same = same && pq.TipNRemove() == ref[tip];
+                ref.erase(tip);
+                live.erase(std::find(live.begin(), live.end(), tip));
+            }
+        }
+
+        if(step % 61 == 0)
+            same = same && SameAs(pq, ref);
+    }
+
+    return same && SameAs(pq, ref);
+}
+
+void mypq_indexed(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyIndexedPQHeap tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomOperations<2>(), "Binary IndexedPQHeap: random Insert/Change/Remove/TipNRemove");
+        Check(loctestnum, loctesterr, RandomOperations<4>(), "4-ary IndexedPQHeap: random Insert/Change/Remove/TipNRemove");
+
+        // Gli handle restano validi mentre gli altri elementi si spostano
+        {
+            lasd::IndexedPQHeap<string> pq;
+
+            ulong b = pq.Insert("b");
+            ulong x = pq.Insert("x");
+            ulong m = pq.Insert("m");
+
+            for(char c = 'c'; c < 'l'; c++)
+                pq.Insert(string(1, c));
+
+            Check(loctestnum, loctesterr, pq.Tip() == "x" && pq.TipHandle() == x, "TipHandle");
+            Check(loctestnum, loctesterr, pq[b] == "b" && pq[m] == "m", "Lookup by handle after the sifts");
+
+            pq.Change(b, string("z"));
+            Check(loctestnum, loctesterr, pq.Tip() == "z" && pq.TipHandle() == b, "Change up to the root (by move)");
+
+            pq.Change(b, "a");
+            Check(loctestnum, loctesterr, pq.Tip() == "x" && pq[b] == "a", "Change down");
+
+            pq.Remove(x);
+            Check(loctestnum, loctesterr, !pq.Contains(x) && pq.Tip() == "m" && pq.Size() == 11, "Remove by handle");
+
+            ulong y = pq.Insert("y");
+            Check(loctestnum, loctesterr, y == x && pq.Contains(y) && pq.Tip() == "y", "Released handles are reused");
+
+            try
+            {
+                pq.Change(1000, "q");
+                Check(loctestnum, loctesterr, false, "Change of an unknown handle must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "Change of an unknown handle throws out_of_range");
+            }
+
+            lasd::IndexedPQHeap<string> copy(pq);
+            Check(loctestnum, loctesterr, copy == pq && copy[m] == "m", "Copy constructor");
+
+            copy.Remove(m);
+            Check(loctestnum, loctesterr, copy != pq && pq.Contains(m), "The copy is independent");
+
+            lasd::IndexedPQHeap<string> moved(std::move(copy));
+            Check(loctestnum, loctesterr, copy.Empty() && moved.Size() == 11, "Move constructor");
+
+            moved.Clear();
+            Check(loctestnum, loctesterr, moved.Empty() && !moved.Contains(b), "Clear");
+
+            try
+            {
+                moved.Tip();
+                Check(loctestnum, loctesterr, false, "Tip of an empty queue must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Tip of an empty queue throws length_error");
+            }
+        }
+
+        // Dijkstra su una coda con il minimo in cima: nessun duplicato in coda
+        {
+            const ulong nodes = 200;
+            Graph graph = RandomGraph(nodes, 777);
+            vector<long> ref = BellmanFord(graph);
+
+            lasd::MinIndexedPQHeap<pair<long, ulong>, 4> pq;
+            vector<long> dist(nodes, -1);
+            vector<ulong> handle(nodes, 0);
+            vector<bool> queued(nodes, false);
+            ulong maxSize = 0;
+
+            dist[0] = 0;
+            handle[0] = pq.Insert({0, 0});
+            queued[0] = true;
+
+            while(!pq.Empty())
+            {
+                maxSize = std::max(maxSize, pq.Size());
+                ulong u = pq.TipNRemove().second;
+                queued[u] = false;
+
+                for(auto [v, w] : graph[u])
+                    if(dist[v] < 0 || dist[u] + w < dist[v])
+                    {
+                        dist[v] = dist[u] + w;
+
+                        if(queued[v])
+                            pq.Change(handle[v], make_pair(dist[v], v));
+                        else
+                        {
+                            handle[v] = pq.Insert({dist[v], v});
+                            queued[v] = true;
+                        }
+                    }
+            }
+
+            Check(loctestnum, loctesterr, dist == ref && maxSize <= nodes, "Dijkstra with Change instead of duplicates");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyIndexedPQHeap tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Confronto con una mappa id -> valore: stessi valori raggiungibili dagli handle, massimo in cima
+bool SameAs(const lasd::PQPairing<long> &pq, const map<ulong, long> &ref, const vector<lasd::PQPairing<long>::Handle> &handles)
+{
+    if(pq.Size() != ref.size())
+        return false;
+
+    long max = 0;
+
+    for(const auto &[id, value] : ref)
+    {
+        if(!pq.Contains(handles[id]) || pq[handles[id]] != value)
+            return false;
+
+        max = (id == ref.begin()->first || max < value) ? value : max;
+    }
+
+    long sum = 0, refSum = 0;
+
+    for(ulong i = 0; i < pq.Size(); i++)
+        sum += pq[i];
+    for(const auto &[id, value] : ref)
+        refSum += value;
+
+    return sum == refSum && (ref.empty() || pq.Tip() == max);
+}
+
+bool RandomPairing()
+{
+    lasd::PQPairing<long> pq;
+    map<ulong, long> ref;
+    vector<lasd::PQPairing<long>::Handle> handles;
+    vector<ulong> live;
+    ulong seed = 4242;
+    bool same = true;
+
+    for(ulong step = 0; step < 6000; step++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ulong op = (seed >> 60) % 6;
+        long value = static_cast<long>((seed >> 33) % 1000);
+
+        if(op <= 1 || live.empty())
+        {
+            ref[handles.size()] = value;
+            live.push_back(handles.size());
+            handles.push_back(pq.Push(value));
+        }
+        else
+        {
+            ulong which = (seed >> 20) % live.size();
+            ulong id = live[which];
+
+            if(op == 2 || op == 3)
+            {
+                pq.Change(handles[id], value);
+                ref[id] = value;
+            }
+            else if(op == 4)
+            {
+                pq.Remove(handles[id]);
+                ref.erase(id);
+                live[which] = live.back();
+                live.pop_back();
+            }
+            else
+            {
+                ulong tip = *std::find_if(live.begin(), live.end(), [&] (ulong curr) { return handles[curr] == pq.TipHandle(); });
+                same = same && pq.TipNRemove() == ref[tip];
+                ref.erase(tip);
+                live.erase(std::find(live.begin(), live.end(), tip));
+            }
+        }
+
+        if(step % 59 == 0)
+            same = same && SameAs(pq, ref, handles);
+    }
+
+    return same && SameAs(pq, ref, handles);
+}
+
+void mypq_pairing(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyPQPairing tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomPairing(), "PQPairing: random Push/Change/Remove/TipNRemove");
+
+        // Interfaccia PQ: posizioni, Change per posizione, eccezioni
+        {
+            lasd::Vector<long> vec(100);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i] = static_cast<long>((i * 37) % 101);
+
+            lasd::PQPairing<long> pq(vec);
+
+            Check(loctestnum, loctesterr, pq.Size() == 100 && pq.Tip() == 100 && pq.Exists(37) && !pq.Exists(101), "PQPairing<long>: built from a Vector");
+
+            pq.Change(pq.Size() - 1, 500L);
+            Check(loctestnum, loctesterr, pq.Tip() == 500, "PQPairing<long>: Change by position up to the tip");
+
+            pq.Change(pq.TipHandle(), -1L);
+            Check(loctestnum, loctesterr, pq.Tip() == 100 && pq.Exists(-1), "PQPairing<long>: Change of the tip down");
+
+            bool ordered = true;
+            long last = pq.TipNRemove();
+
+            while(!pq.Empty())
+            {
+                long curr = pq.TipNRemove();
+                ordered = ordered && curr <= last;
+                last = curr;
+            }
+
+            Check(loctestnum, loctesterr, ordered && last == -1, "PQPairing<long>: TipNRemove in descending order");
+
+            try
+            {
+                pq.RemoveTip();
+                Check(loctestnum, loctesterr, false, "RemoveTip of an empty PQPairing must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "RemoveTip of an empty PQPairing throws length_error");
+            }
+
+            try
+            {
+                pq.Push(3);
+                pq[1];
+                Check(loctestnum, loctesterr, false, "operator[] out of range must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "operator[] out of range throws out_of_range");
+            }
+        }
+
+        // Handle: validi durante le ristrutturazioni e dopo Meld
+        {
+            lasd::PQPairing<string> fst, snd;
+
+            auto b = fst.Push("b");
+            auto k = fst.Push("k");
+            fst.Push("f");
+
+            auto x = snd.Push("x");
+            auto c = snd.Push("c");
+            snd.Push("p");
+
+            fst.RemoveTip();
+            Check(loctestnum, loctesterr, fst.Tip() == "f" && !fst.Contains(k) && fst[b] == "b", "Handles after RemoveTip");
+
+            fst.Meld(std::move(snd));
+            Check(loctestnum, loctesterr, snd.Empty() && fst.Size() == 5 && fst.Tip() == "x" && fst.TipHandle() == x, "Meld");
+            Check(loctestnum, loctesterr, fst[c] == "c" && fst.Exists("p") && fst[4] != "", "Handles and positions after Meld");
+
+            fst.Change(c, string("z"));
+            fst.Change(x, "a");
+            Check(loctestnum, loctesterr, fst.Tip() == "z" && fst.TipHandle() == c && fst[x] == "a", "Change by handle after Meld");
+
+            fst.Remove(c);
+
+            string order;
+            lasd::PQPairing<string> copy(fst);
+
+            Check(loctestnum, loctesterr, copy == fst && copy.Size() == 4, "Copy constructor");
+
+            while(!copy.Empty())
+                order += copy.TipNRemove();
+
+            Check(loctestnum, loctesterr, order == "pfba" && fst.Size() == 4 && fst[b] == "b", "The copy is independent");
+
+            snd.Push("q");
+            snd.Meld(std::move(fst));
+            Check(loctestnum, loctesterr, snd.Size() == 5 && snd.Tip() == "q" && snd[x] == "a", "Meld into a queue with its own chunks");
+
+            try
+            {
+                snd.Change(k, "c");
+                Check(loctestnum, loctesterr, false, "Change of a removed handle must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, !fst.Contains(lasd::PQPairing<string>::Handle()), "Change of a removed handle throws out_of_range");
+            }
+
+            lasd::PQPairing<string> moved(std::move(snd));
+            Check(loctestnum, loctesterr, snd.Empty() && moved.Size() == 5 && moved[b] == "b", "Move constructor");
+
+            // Clear tiene i nodi: gli handle rilasciati si possono ancora interrogare
+            moved.Clear();
+            Check(loctestnum, loctesterr, moved.Empty() && !moved.Contains(b) && !moved.Contains(x), "Handles after Clear");
+
+            auto r = moved.Push("r");
+            moved.Push("s");
+            Check(loctestnum, loctesterr, moved.Size() == 2 && moved.Tip() == "s" && moved[r] == "r" && moved[0] != "", "Push after Clear");
+        }
+
+        // Dijkstra con decrease-key sugli handle
+        {
+            const ulong nodes = 300;
+            Graph graph = RandomGraph(nodes, 999);
+            vector<long> ref = BellmanFord(graph);
+
+            lasd::MinPQPairing<pair<long, ulong>> pq;
+            vector<long> dist(nodes, -1);
+            vector<lasd::MinPQPairing<pair<long, ulong>>::Handle> handle(nodes);
+
+            dist[0] = 0;
+            handle[0] = pq.Push({0, 0});
+
+            while(!pq.Empty())
+            {
+                ulong u = pq.TipNRemove().second;
+
+                for(auto [v, w] : graph[u])
+                    if(dist[v] < 0 || dist[u] + w < dist[v])
+                    {
+                        dist[v] = dist[u] + w;
+
+                        if(pq.Contains(handle[v]))
+                            pq.Change(handle[v], make_pair(dist[v], v));
+                        else
+                            handle[v] = pq.Push({dist[v], v});
+                    }
+            }
+
+            Check(loctestnum, loctesterr, dist == ref, "MinPQPairing: Dijkstra with Change on handles");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyPQPairing tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Confronto con un multiset: stesse coppie, chiave minima in cima
+bool SameAs(const lasd::PQRadix<ulong, ulong> &pq, const multiset<pair<ulong, ulong>> &ref)
+{
+    if(pq.Size() != ref.size())
+        return false;
+
+    multiset<pair<ulong, ulong>> content;
+
+    pq.Traverse
+    (
+        [&content] (const pair<ulong, ulong> &curr)
+        {
+            content.insert(curr);
+        }
+    );
+
+    return content == ref && (ref.empty() || pq.Tip().first == ref.begin()->first);
+}
+
+bool RandomRadix()
+{
+    lasd::PQRadix<ulong, ulong> pq;
+    multiset<pair<ulong, ulong>> ref;
+    ulong seed = 777;
+    bool same = true;
+
+    for(ulong step = 0; step < 6000; step++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ulong op = (seed >> 60) % 5;
+        // Distanze dall'ultima chiave tolta su scale diverse, fino a 2^40
+        ulong key = pq.Last() + (((seed >> 20) % 1000) << ((seed >> 8) % 5 * 10));
+
+        if(op <= 1 || ref.empty())
+        {
+            pq.Insert({key, step});
+            ref.insert({key, step});
+        }
+        else if(op == 2)
+        {
+            ulong index = (seed >> 30) % pq.Size();
+
+            ref.erase(ref.find(pq[index]));
+            pq.Change(index, make_pair(key, step));
+            ref.insert({key, step});
+        }
+        else
+        {
+            auto tip = pq.TipNRemove();
+            same = same && tip.first == ref.begin()->first && ref.count(tip) > 0 && pq.Last() == tip.first;
+            ref.erase(ref.find(tip));
+        }
+
+        if(step % 59 == 0)
+            same = same && SameAs(pq, ref);
+    }
+
+    return same && SameAs(pq, ref);
+}
+
+void mypq_radix(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyPQRadix tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomRadix(), "PQRadix: random monotone Insert/Change/TipNRemove");
+
+        // Interfaccia PQ, chiave minima in cima, eccezioni
+        {
+            lasd::Vector<pair<ulong, ulong>> vec(100);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i] = {(i * 37) % 101 + 5, i};
+
+            lasd::PQRadix<ulong, ulong> pq(vec);
+
+            Check(loctestnum, loctesterr, pq.Size() == 100 && pq.Tip().first == 5 && pq.Exists({42, 1}) && !pq.Exists({42, 2}), "PQRadix<ulong, ulong>: built from a Vector");
+
+            // Chiavi attese in ordine dopo la Change
+            vector<ulong> keys;
+            pq.Traverse([&keys] (const pair<ulong, ulong> &curr) { keys.push_back(curr.first); });
+            keys[std::find(keys.begin(), keys.end(), pq[pq.Size() - 1].first) - keys.begin()] = 3;
+            std::sort(keys.begin(), keys.end());
+
+            pq.Change(pq.Size() - 1, make_pair(3UL, 1000UL));
+            Check(loctestnum, loctesterr, pq.Tip() == make_pair(3UL, 1000UL), "PQRadix<ulong, ulong>: Change by position down to the tip");
+
+            bool ordered = true;
+            ulong last = pq.TipNRemove().first;
+
+            while(pq.Size() > 50)
+            {
+                ulong curr = pq.TipNRemove().first;
+                ordered = ordered && curr >= last && pq.Last() == curr;
+                last = curr;
+            }
+
+            Check(loctestnum, loctesterr, ordered && last == keys[49], "PQRadix<ulong, ulong>: TipNRemove in ascending order");
+
+            try
+            {
+                pq.Insert({last - 1, 0});
+                Check(loctestnum, loctesterr, false, "Insert below Last must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, pq.Size() == 50, "Insert below Last throws out_of_range");
+            }
+
+            pq.Insert({last, 0});
+            pq.Change(pq.Size() - 1, make_pair(1000UL, 7UL));
+            Check(loctestnum, loctesterr, pq.TipNRemove() == make_pair(last, 0UL) && pq.Exists({1000, 7}), "PQRadix<ulong, ulong>: Insert of the last key and Change up");
+
+            lasd::PQRadix<ulong, ulong> copy(pq);
+            Check(loctestnum, loctesterr, copy == pq, "Copy constructor");
+
+            copy.RemoveTip();
+            Check(loctestnum, loctesterr, copy != pq && copy.Size() == 49 && pq.Size() == 50, "The copy is independent");
+
+            lasd::PQRadix<ulong, ulong> moved(std::move(copy));
+            Check(loctestnum, loctesterr, copy.Empty() && moved.Size() == 49, "Move constructor");
+
+            pq.Clear();
+
+            try
+            {
+                pq.RemoveTip();
+                Check(loctestnum, loctesterr, false, "RemoveTip of an empty PQRadix must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "RemoveTip of an empty PQRadix throws length_error");
+            }
+
+            moved = lasd::PQRadix<ulong, ulong>();
+            moved.Insert({10, 0});
+            moved.RemoveTip();
+            moved.Insert({4, 0});
+            Check(loctestnum, loctesterr, moved.Tip().first == 4 && moved.Last() == 4, "An empty PQRadix accepts any key");
+        }
+
+        // Chiavi a 8 bit fino al massimo
+        {
+            lasd::PQRadix<unsigned char, char> pq;
+            string order;
+
+            pq.Insert({255, 'z'});
+            pq.Insert({0, 'a'});
+            pq.Insert({128, 'm'});
+            pq.Insert({127, 'l'});
+
+            order += pq.TipNRemove().second;
+            pq.Insert({1, 'b'});
+
+            while(!pq.Empty())
+                order += pq.TipNRemove().second;
+
+            Check(loctestnum, loctesterr, order == "ablmz" && pq.Last() == 255, "PQRadix<unsigned char, char>: full key range");
+        }
+
+        // Dijkstra con inserimenti duplicati: le distanze estratte non decrescono mai
+        {
+            const ulong nodes = 300;
+            Graph graph = RandomGraph(nodes, 999);
+            vector<long> ref = BellmanFord(graph);
+
+            lasd::PQRadix<ulong, ulong> pq;
+            vector<long> dist(nodes, -1);
+
+            dist[0] = 0;
+            pq.Insert({0, 0});
+
+            while(!pq.Empty())
+            {
+                auto [d, u] = pq.TipNRemove();
+
+                if(static_cast<long>(d) != dist[u])
+                    continue;
+
+                for(auto [v, w] : graph[u])
+                    if(dist[v] < 0 || dist[u] + w < dist[v])
+                    {
+                        dist[v] = dist[u] + w;
+                        pq.Insert({static_cast<ulong>(dist[v]), v});
+                    }
+            }
+
+            Check(loctestnum, loctesterr, dist == ref, "PQRadix: Dijkstra");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyPQRadix tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Confronto con un multiset: stessi valori, minimo e massimo agli estremi, invarianti dei livelli
+bool SameAs(const lasd::MinMaxHeap<long> &heap, const multiset<long> &ref)
+{
+    if(heap.Size() != ref.size() || !heap.IsHeap())
+        return false;
+
+    multiset<long> content;
+
+    for(ulong i = 0; i < heap.Size(); i++)
+        content.insert(heap[i]);
+
+    return content == ref && (ref.empty() || (heap.Min() == *ref.begin() && heap.Max() == *ref.rbegin()));
+}
+
+bool RandomMinMax()
+{
+    lasd::MinMaxHeap<long> heap;
+    multiset<long> ref;
+    ulong seed = 31337;
+    bool same = true;
+
+    for(ulong step = 0; step < 8000; step++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ulong op = (seed >> 60) % 6;
+        long value = static_cast<long>((seed >> 33) % 2000) - 1000;
+
+        if(op <= 1 || ref.empty())
+        {
+            heap.Insert(value);
+            ref.insert(value);
+        }
+        else if(op == 2 || op == 3)
+        {
+            ulong index = (seed >> 20) % heap.Size();
+
+            ref.erase(ref.find(heap[index]));
+            heap.Change(index, value);
+            ref.insert(value);
+        }
+        else if(op == 4)
+        {
+            same = same && heap.MinNRemove() == *ref.begin();
+            ref.erase(ref.begin());
+        }
+        else
+        {
+            same = same && heap.MaxNRemove() == *ref.rbegin();
+            ref.erase(std::prev(ref.end()));
+        }
+
+        if(step % 37 == 0)
+            same = same && SameAs(heap, ref);
+    }
+
+    return same && SameAs(heap, ref);
+}
+
+void mypq_minmax(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyMinMaxHeap tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomMinMax(), "MinMaxHeap: random Insert/Change/MinNRemove/MaxNRemove");
+
+        // Costruzione da contenitore, estrazione alternata dai due estremi
+        {
+            bool built = true, alternated = true;
+
+            for(ulong length : {0UL, 1UL, 2UL, 3UL, 7UL, 100UL, 1001UL})
+            {
+                lasd::Vector<long> vec(length);
+                std::vector<long> ref(length);
+
+                for(ulong i = 0; i < length; i++)
+                    vec[i] = ref[i] = static_cast<long>((i * 2654435761UL) % 1009);
+
+                std::sort(ref.begin(), ref.end());
+
+                lasd::MinMaxHeap<long> heap(vec);
+                built = built && heap.IsHeap() && heap.Size() == length;
+
+                for(ulong lo = 0, hi = length; lo < hi; )
+                    alternated = alternated && ((lo + hi) % 2 == 0 ? heap.MinNRemove() == ref[lo++] : heap.TipNRemove() == ref[--hi]);
+
+                alternated = alternated && heap.Empty();
+            }
+
+            Check(loctestnum, loctesterr, built, "MinMaxHeap<long>: construction gives a min-max heap");
+            Check(loctestnum, loctesterr, alternated, "MinMaxHeap<long>: alternate MinNRemove and TipNRemove");
+        }
+
+        // Interfaccia PQ, comparatore, copia e spostamento, eccezioni
+        {
+            lasd::MinMaxHeap<string, std::greater<string>> heap;
+
+            heap.Insert("kilo");
+            heap.Insert("alfa");
+            heap.Insert("zulu");
+            heap.Insert("mike");
+
+            Check(loctestnum, loctesterr, heap.Min() == "zulu" && heap.Max() == "alfa" && heap.Tip() == "alfa", "MinMaxHeap<string, greater>: the order is reversed");
+
+            heap.Change(0, string("bravo"));
+            Check(loctestnum, loctesterr, heap.Min() == "mike" && heap.Max() == "alfa" && heap.IsHeap() && heap.Exists("bravo"), "MinMaxHeap<string, greater>: Change of the minimum");
+
+            lasd::MinMaxHeap<string, std::greater<string>> copy(heap);
+            Check(loctestnum, loctesterr, copy == heap, "Copy constructor");
+
+            copy.RemoveMin();
+            copy.RemoveTip();
+            Check(loctestnum, loctesterr, copy != heap && copy.Size() == 2 && copy.Min() == "kilo" && copy.Max() == "bravo" && heap.Size() == 4, "The copy is independent");
+
+            lasd::MinMaxHeap<string, std::greater<string>> moved(std::move(copy));
+            Check(loctestnum, loctesterr, copy.Empty() && moved.Size() == 2, "Move constructor");
+
+            moved = heap;
+            heap.Clear();
+            Check(loctestnum, loctesterr, heap.Empty() && moved.Size() == 4 && moved.Min() == "mike", "Copy assignment and Clear");
+
+            try
+            {
+                heap.Max();
+                Check(loctestnum, loctesterr, false, "Max of an empty MinMaxHeap must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Max of an empty MinMaxHeap throws length_error");
+            }
+
+            try
+            {
+                moved.Change(4, "x");
+                Check(loctestnum, loctesterr, false, "Change out of range must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "Change out of range throws out_of_range");
+            }
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyMinMaxHeap tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+struct Job {
+
+    int priority = 0;
+    int id = 0;
+
+    bool operator==(const Job &) const noexcept = default;
+
+};
+
+// Ordine per priorita' con la chiave intera esposta: priorita' e ticket in una sola chiave
+struct KeyedJobOrder {
+
+    static int Key(const Job &job) noexcept { return job.priority; }
+
+    bool operator()(const Job &fst, const Job &snd) const noexcept { return fst.priority < snd.priority; }
+
+};
+
+// Lo stesso ordine senza chiave: il ticket rompe i pareggi di Compare
+struct WideJobOrder {
+
+    bool operator()(const Job &fst, const Job &snd) const noexcept { return fst.priority < snd.priority; }
+
+};
+
+// Espone il contatore dei ticket per arrivare al limite dei 32 bit
+class WrappingStablePQHeap : public lasd::StablePQHeap<Job, 2, KeyedJobOrder> {
+
+public:
+
+    void SkipTo(ulong next) { ticket = next; }
+
+};
+
+// Espone la dimensione delle voci: un intero non porta ticket e occupa quanto l'elemento
+class SizedStablePQHeap : public lasd::MinStablePQHeap<int> {
+
+public:
+
+    static constexpr ulong EntrySize = sizeof(Entry);
+
+};
+
+// Estrazioni intercalate agli inserimenti: ogni estratto ha la priorita' massima e, a pari
+// priorita', l'id (ordine di inserimento) minimo tra i presenti
+template <typename Queue>
+bool RandomStable()
+{
+    Queue pq;
+    std::set<pair<int, int>> ref; // (-priorita', id)
+    ulong seed = 4242;
+    bool fifo = true;
+
+    for(int id = 0; id < 6000; id++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+
+        int priority = static_cast<int>((seed >> 40) % 8) - 4;
+
+        pq.Insert(Job {priority, id});
+        ref.insert({-priority, id});
+
+        if((seed >> 20) % 3 == 0)
+        {
+            Job tip = pq.TipNRemove();
+            fifo = fifo && make_pair(-tip.priority, tip.id) == *ref.begin();
+            ref.erase(ref.begin());
+        }
+    }
+
+    while(!pq.Empty())
+    {
+        Job tip = pq.TipNRemove();
+        fifo = fifo && make_pair(-tip.priority, tip.id) == *ref.begin();
+        ref.erase(ref.begin());
+    }
+
+    return fifo && ref.empty();
+}
+
+template <typename Queue>
+ulong IndexOf(const Queue &pq, int id)
+{
+    for(ulong i = 0; i < pq.Size(); i++)
+        if(pq[i].id == id)
+            return i;
+
+    return pq.Size();
+}
+
+void mypq_stable(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyStablePQHeap tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomStable<lasd::StablePQHeap<Job, 2, KeyedJobOrder>>(), "StablePQHeap (packed key): FIFO among equal priorities");
+        Check(loctestnum, loctesterr, RandomStable<lasd::StablePQHeap<Job, 2, WideJobOrder>>(), "StablePQHeap (ticket next to the value): FIFO among equal priorities");
+        Check(loctestnum, loctesterr, RandomStable<lasd::StablePQHeap<Job, 4, KeyedJobOrder>>(), "StablePQHeap (4-ary): FIFO among equal priorities");
+
+        // Costruzione da contenitore: ticket nell'ordine di attraversamento
+        {
+            lasd::Vector<Job> vec(6);
+
+            for(int i = 0; i < 6; i++)
+                vec[i] = Job {i % 2, i};
+
+            lasd::StablePQHeap<Job, 2, KeyedJobOrder> pq(vec);
+            string order;
+
+            while(!pq.Empty())
+                order += to_string(pq.TipNRemove().id);
+
+            Check(loctestnum, loctesterr, order == "135024", "StablePQHeap: construction from a container keeps the traversal order");
+        }
+
+        // Change mantiene il ticket: l'elemento torna davanti a quelli inseriti dopo
+        {
+            lasd::StablePQHeap<Job, 2, KeyedJobOrder> pq;
+
+            pq.Insert(Job {5, 1});
+            pq.Insert(Job {5, 2});
+            pq.Insert(Job {1, 3});
+
+            pq.Change(IndexOf(pq, 1), Job {0, 1});
+            Check(loctestnum, loctesterr, pq.Tip().id == 2, "StablePQHeap: Change lowers the priority");
+
+            pq.Change(IndexOf(pq, 1), Job {5, 1});
+            pq.Change(IndexOf(pq, 3), Job {5, 3});
+
+            string order;
+
+            while(!pq.Empty())
+                order += to_string(pq.TipNRemove().id);
+
+            Check(loctestnum, loctesterr, order == "123", "StablePQHeap: Change keeps the ticket");
+        }
+
+        // Rinumerazione quando il contatore a 32 bit finisce
+        {
+            WrappingStablePQHeap pq;
+
+            pq.Insert(Job {1, 0});
+            pq.Insert(Job {2, 1});
+            pq.SkipTo(UINT32_MAX - 2);
+
+            for(int id = 2; id < 10; id++)
+                pq.Insert(Job {id % 2 + 1, id});
+
+            string order;
+
+            while(!pq.Empty())
+                order += to_string(pq.TipNRemove().id);
+
+            Check(loctestnum, loctesterr, order == "1357902468", "StablePQHeap: tickets renumbered past 32 bits keep the order");
+        }
+
+        // Interi, comparatore invertito, copia e spostamento, eccezioni
+        {
+            lasd::MinStablePQHeap<int> pq;
+
+            for(int value : {3, -7, 0, 12, -7, -2147483647 - 1, 2147483647})
+                pq.Insert(value);
+
+            lasd::MinStablePQHeap<int> copy(pq);
+            Check(loctestnum, loctesterr, copy == pq && copy.Tip() == -2147483647 - 1, "MinStablePQHeap<int>: copy constructor and minimum in the tip");
+
+            string order;
+
+            while(!copy.Empty())
+                order += to_string(copy.TipNRemove()) + " ";
+
+            Check(loctestnum, loctesterr, order == "-2147483648 -7 -7 0 3 12 2147483647 ", "MinStablePQHeap<int>: ascending order across the sign");
+            Check(loctestnum, loctesterr, copy != pq && pq.Size() == 7, "The copy is independent");
+            Check(loctestnum, loctesterr, SizedStablePQHeap::EntrySize == sizeof(int), "MinStablePQHeap<int>: entries as large as the elements");
+
+            pq.Change(0, 5);
+            Check(loctestnum, loctesterr, pq.Tip() == -7 && pq.Size() == 7, "MinStablePQHeap<int>: Change of the tip");
+            pq.Change(pq.Size() - 1, -2147483647 - 1);
+
+            lasd::MinStablePQHeap<int> moved(std::move(pq));
+            Check(loctestnum, loctesterr, pq.Empty() && moved.Size() == 7, "Move constructor");
+
+            pq = moved;
+            moved.Clear();
+            Check(loctestnum, loctesterr, moved.Empty() && pq.Size() == 7 && pq.Tip() == -2147483647 - 1, "Copy assignment and Clear");
+
+            try
+            {
+                moved.Tip();
+                Check(loctestnum, loctesterr, false, "Tip of an empty StablePQHeap must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Tip of an empty StablePQHeap throws length_error");
+            }
+
+            try
+            {
+                pq.Change(7, 1);
+                Check(loctestnum, loctesterr, false, "Change out of range must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "Change out of range throws out_of_range");
+            }
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyStablePQHeap tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+}
+
+/* ************************************************************************** */
+
+void mypqext_test(uint &testnum, uint &testerr)
+{
+    mypq_indexed(testnum, testerr);
+    mypq_pairing(testnum, testerr);
+    mypq_radix(testnum, testerr);
+    mypq_minmax(testnum, testerr);
+    mypq_stable(testnum, testerr);
+}
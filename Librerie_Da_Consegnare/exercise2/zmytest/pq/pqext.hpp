@@ -0,0 +1,6 @@
+#ifndef __PQEXT_H__
+#define __PQEXT_H__
+
+void mypqext_test(unsigned int &, unsigned int &);
+
+#endif // __PQEXT_H__
@@ -0,0 +1,1059 @@
+#include <iostream>
+#include <string>
+#include <set>
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <atomic>
+
+/* ************************************************************************** */
+
+#include "../../zlasdtest/container/container.hpp"
+
+#include "../check.hpp"
+
+/* ************************************************************************** */
+
+#include "../../set/vec/setvec.hpp"
+#include "../../set/lst/setlst.hpp"
+#include "../../set/frozen/frozenset.hpp"
+#include "../../set/adaptive/adaptiveset.hpp"
+#include "../../merge/kwaymerge.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Tipi e funzioni di supporto: linkage interno, cosi' non si scontrano con quelli degli altri file di test
+namespace {
+
+// Confronto elemento per elemento con un std::set di riferimento
+template <typename Data, typename Order>
+bool SameAs(const lasd::LinearContainer<Data> &con, const std::set<Data, Order> &ref)
+{
+    if(con.Size() != ref.size())
+        return false;
+
+    ulong i = 0;
+    for(const Data &dat : ref)
+        if(con[i++] != dat)
+            return false;
+
+    return true;
+}
+
+/* ************************************************************************** */
+
+void mysetvec_ring(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MySetVec ring buffer tests: ----------------------" << endl;
+
+        // Inserimenti alternati in testa e in coda: head fa il giro del buffer
+        {
+            lasd::SetVec<int> set;
+            std::set<int> ref;
+
+            for(int i = 0; i < 200; i++)
+            {
+                int val = (i % 2 == 0) ? 1000 + i : -1000 - i;
+                set.Insert(val);
+                ref.insert(val);
+            }
+            Check(loctestnum, loctesterr, SameAs(set, ref), "Alternate head/tail inserts");
+
+            for(int i = 0; i < 150; i++)
+            {
+                set.Insert(i * 3);
+                ref.insert(i * 3);
+            }
+            Check(loctestnum, loctesterr, SameAs(set, ref), "Middle inserts across the wrap point");
+
+            for(int i = 0; i < 150; i += 2)
+            {
+                set.Remove(i * 3);
+                ref.erase(i * 3);
+            }
+            Check(loctestnum, loctesterr, SameAs(set, ref), "Middle removes across the wrap point");
+        }
+
+        // Sequenza pseudo-casuale di inserimenti e rimozioni (con shrink e grow)
+        {
+            lasd::SetVec<int> set;
+            std::set<int> ref;
+            ulong seed = 12345;
+            bool same = true;
+
+            for(uint step = 0; step < 4000; step++)
+            {
+                seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+                int val = static_cast<int>((seed >> 33) % 512);
+
+                if((seed >> 20) % 3 == 0 || (step / 1000) % 2 == 1)
+                {
+                    set.Remove(val);
+                    ref.erase(val);
+                }
+                else
+                {
+                    set.Insert(val);
+                    ref.insert(val);
+                }
+
+                if(step % 97 == 0)
+                    same = same && SameAs(set, ref);
+            }
+            Check(loctestnum, loctesterr, same && SameAs(set, ref), "Random inserts/removes (int)");
+        }
+
+        // Tipo non banalmente copiabile: gli shift usano std::move
+        {
+            lasd::SetVec<string> set;
+            std::set<string> ref;
+
+            for(int i = 0; i < 300; i++)
+            {
+                string val = to_string((i * 7919) % 1000);
+                set.Insert(val);
+                ref.insert(val);
+            }
+            for(int i = 0; i < 300; i += 3)
+            {
+                string val = to_string((i * 7919) % 1000);
+                set.Remove(val);
+                ref.erase(val);
+            }
+            Check(loctestnum, loctesterr, SameAs(set, ref), "Scrambled inserts/removes (string)");
+
+            lasd::SetVec<string> copy(set);
+            Check(loctestnum, loctesterr, copy == set, "Copy of a wrapped set");
+
+            while(!ref.empty())
+            {
+                set.RemoveMin();
+                ref.erase(ref.begin());
+            }
+            Check(loctestnum, loctesterr, set.Empty() && !copy.Empty(), "RemoveMin until empty (the copy is untouched)");
+        }
+
+        // Costruzione in blocco da un contenitore con duplicati (copia e spostamento)
+        {
+            lasd::Vector<int> vec(20000);
+            std::set<int> ref;
+
+            for(ulong i = 0; i < vec.Size(); i++)
+            {
+                vec[i] = static_cast<int>((i * 7919) % 3001) - 1500;
+                ref.insert(vec[i]);
+            }
+
+            lasd::SetVec<int> set(vec);
+            Check(loctestnum, loctesterr, SameAs(set, ref) && set.Exists(-1500) && !set.Exists(1501), "Bulk build from a Vector with duplicates");
+
+            lasd::SetVec<int> moved(std::move(vec));
+            Check(loctestnum, loctesterr, moved == set, "Bulk build from a moved Vector");
+
+            moved.Insert(5000);
+            moved.Remove(-1500);
+            ref.insert(5000);
+            ref.erase(-1500);
+            Check(loctestnum, loctesterr, SameAs(moved, ref), "Inserts/removes after a bulk build");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MySetVec ring buffer tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+void mysetvec_search(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MySetVec search tests: ----------------------" << endl;
+
+        // Chiavi pari, con head spostato: le ricerche attraversano il punto di wrap
+        {
+            lasd::SetVec<int> set;
+            std::set<int> ref;
+
+            for(int i = 0; i < 1000; i += 2)
+            {
+                set.Insert(i);
+                ref.insert(i);
+            }
+            for(int i = 0; i < 100; i += 2)
+            {
+                set.RemoveMin();
+                ref.erase(ref.begin());
+                set.Insert(-i - 2);
+                ref.insert(-i - 2);
+            }
+
+            bool exists = true, pred = true, succ = true;
+
+            for(int key = -120; key < 1010; key++)
+            {
+                exists = exists && (set.Exists(key) == (ref.count(key) == 1));
+
+                auto lb = ref.lower_bound(key);
+                if(lb == ref.begin())
+                {
+                    try { set.Predecessor(key); pred = false; } catch(const std::length_error &) {}
+                }
+                else
+                    pred = pred && set.Predecessor(key) == *std::prev(lb);
+
+                auto ub = ref.upper_bound(key);
+                if(ub == ref.end())
+                {
+                    try { set.Successor(key); succ = false; } catch(const std::length_error &) {}
+                }
+                else
+                    succ = succ && set.Successor(key) == *ub;
+            }
+
+            Check(loctestnum, loctesterr, exists, "Exists on every key of the range");
+            Check(loctestnum, loctesterr, pred, "Predecessor on every key of the range");
+            Check(loctestnum, loctesterr, succ, "Successor on every key of the range");
+        }
+
+        // Dimensioni piccole (1, 2, 3 elementi): casi limite della ricerca
+        {
+            bool correct = true;
+
+            for(int n = 1; n <= 3; n++)
+            {
+                lasd::SetVec<int> set;
+
+                for(int i = 0; i < n; i++)
+                    set.Insert(10 * i);
+
+                for(int key = -5; key <= 10 * n; key += 5)
+                {
+                    correct = correct && (set.Exists(key) == (key >= 0 && key % 10 == 0 && key < 10 * n));
+                    correct = correct && (key <= 0 || set.Predecessor(key) == ((key - 1) / 10) * 10);
+                }
+            }
+
+            Check(loctestnum, loctesterr, correct, "Exists/Predecessor on sets of size 1, 2, 3");
+        }
+
+        // Set piccoli a cavallo del punto di wrap: Exists usa la scansione lineare
+        {
+            bool correct = true;
+
+            for(int n = 1; n <= 70; n++)
+            {
+                lasd::SetVec<double> set;
+
+                for(int i = 0; i < n; i++)
+                    set.Insert(i * 1.5);
+                for(int i = 1; i <= n / 2; i++)
+                    set.Insert(-i * 1.5);
+
+                for(int i = -n; i <= n + 1; i++)
+                    correct = correct && set.Exists(i * 1.5) == (i >= -(n / 2) && i < n) && !set.Exists(i * 1.5 + 0.25);
+            }
+
+            Check(loctestnum, loctesterr, correct, "Exists on wrapped sets of size up to 105 (SetVec<double>)");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MySetVec search tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Tutte le interrogazioni di un FrozenSet confrontate con un std::set, su [lo, hi]
+template <typename Data>
+bool SameQueries(const lasd::FrozenSet<Data> &frz, const std::set<Data> &ref, int lo, int hi)
+{
+    bool correct = (frz.Size() == ref.size());
+
+    for(int key = lo; key <= hi && correct; key++)
+    {
+        correct = (frz.Exists(key) == (ref.count(key) == 1));
+
+        auto lb = ref.lower_bound(key);
+        if(lb == ref.begin())
+        {
+            try { frz.Predecessor(key); correct = false; } catch(const std::length_error &) {}
+        }
+        else
+            correct = correct && frz.Predecessor(key) == *std::prev(lb);
+
+        auto ub = ref.upper_bound(key);
+        if(ub == ref.end())
+        {
+            try { frz.Successor(key); correct = false; } catch(const std::length_error &) {}
+        }
+        else
+            correct = correct && frz.Successor(key) == *ub;
+    }
+
+    return correct;
+}
+
+// Due chiavi sono equivalenti quando hanno la stessa ultima cifra
+struct LastDigit {
+
+    bool operator()(int fst, int snd) const noexcept { return fst % 10 < snd % 10; }
+
+};
+
+void mysetfrozen(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyFrozenSet tests: ----------------------" << endl;
+
+        // Set vuoto
+        {
+            lasd::SetVec<int> set;
+            lasd::FrozenSet<int> frz = set.Freeze();
+
+            Empty(loctestnum, loctesterr, frz, true);
+            Size(loctestnum, loctesterr, frz, true, 0);
+            Check(loctestnum, loctesterr, !frz.Exists(0), "Exists(0) on the empty snapshot");
+
+            bool thrown = false;
+            try { frz.Min(); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Min on the empty snapshot throws length_error");
+
+            thrown = false;
+            try { frz.Max(); } catch(const std::length_error &) { thrown = true; }
+            Check(loctestnum, loctesterr, thrown, "Max on the empty snapshot throws length_error");
+        }
+
+        // Tutte le dimensioni fino a 70: alberi completi e incompleti
+        {
+            bool queries = true, order = true, extremes = true;
+
+            for(int n = 1; n <= 70; n++)
+            {
+                lasd::SetVec<int> set;
+                std::set<int> ref;
+
+                for(int i = 0; i < n; i++)
+                {
+                    set.Insert(3 * i);
+                    ref.insert(3 * i);
+                }
+
+                lasd::FrozenSet<int> frz = set.Freeze();
+
+                queries = queries && SameQueries(frz, ref, -2, 3 * n + 1);
+                extremes = extremes && frz.Min() == 0 && frz.Max() == 3 * (n - 1);
+
+                lasd::Vector<int> vec(frz);
+                for(int i = 0; i < n; i++)
+                    order = order && vec[i] == 3 * i;
+            }
+
+            Check(loctestnum, loctesterr, queries, "Exists/Predecessor/Successor for every size up to 70");
+            Check(loctestnum, loctesterr, order, "In-order Traverse for every size up to 70");
+            Check(loctestnum, loctesterr, extremes, "Min/Max for every size up to 70");
+        }
+
+        // Snapshot di un SetLst, copia, spostamento e confronto
+        {
+            lasd::SetLst<int> lst;
+            std::set<int> ref;
+
+            for(int i = 0; i < 500; i++)
+            {
+                lst.Insert((i * 7919) % 2000);
+                ref.insert((i * 7919) % 2000);
+            }
+
+            lasd::FrozenSet<int> frz(lst);
+            Check(loctestnum, loctesterr, SameQueries(frz, ref, -1, 2001), "Snapshot of a SetLst");
+
+            int sum = frz.Fold<int>([] (const int &dat, const int &acc) { return acc + dat; }, 0);
+            int refsum = 0;
+            for(int dat : ref)
+                refsum += dat;
+            Check(loctestnum, loctesterr, sum == refsum, "Fold over the snapshot");
+
+            lasd::FrozenSet<int> copy(frz);
+            Check(loctestnum, loctesterr, copy == frz, "Copy constructor");
+
+            lasd::FrozenSet<int> moved(std::move(copy));
+            Check(loctestnum, loctesterr, moved == frz && copy.Empty(), "Move constructor");
+
+            lst.Insert(-1);
+            Check(loctestnum, loctesterr, !frz.Exists(-1), "The snapshot does not see later inserts");
+
+            copy = lasd::FrozenSet<int>(lst);
+            Check(loctestnum, loctesterr, copy != frz && copy.Min() == -1, "Move assignment of a new snapshot");
+
+            copy = frz;
+            Check(loctestnum, loctesterr, copy == frz, "Copy assignment");
+        }
+
+        // Stringhe
+        {
+            lasd::SetVec<string> set;
+
+            for(string str : {"delta", "alfa", "echo", "charlie", "bravo"})
+                set.Insert(str);
+
+            lasd::FrozenSet<string> frz = set.Freeze();
+
+            Check(loctestnum, loctesterr, frz.Exists("charlie") && !frz.Exists("foxtrot"), "Exists on strings");
+            Check(loctestnum, loctesterr, frz.Predecessor("c") == "bravo", "Predecessor(\"c\") is \"bravo\"");
+            Check(loctestnum, loctesterr, frz.Successor("delta") == "echo", "Successor(\"delta\") is \"echo\"");
+            Check(loctestnum, loctesterr, frz.Min() == "alfa" && frz.Max() == "echo", "Min/Max on strings");
+        }
+
+        // Set con un ordine diverso dal comparatore: le chiavi vengono riordinate
+        {
+            lasd::SetLst<int> lst;
+
+            for(int i = 0; i < 100; i++)
+                lst.Insert((i * 37) % 100);
+
+            lasd::FrozenSet<int, std::greater<int>> frz(lst);
+
+            bool found = true;
+            for(int i = 0; i < 100; i++)
+                found = found && frz.Exists(i);
+
+            int prev = 100;
+            bool descending = true;
+            frz.Traverse([&prev, &descending] (const int &curr) { descending = descending && curr < prev; prev = curr; });
+
+            Check(loctestnum, loctesterr, frz.Size() == 100 && found && !frz.Exists(100) && descending, "FrozenSet<int, greater> from an ascending SetLst");
+            Check(loctestnum, loctesterr, frz.Min() == 99 && frz.Max() == 0 && frz.Predecessor(50) == 51 && frz.Successor(50) == 49, "Min/Max/Predecessor/Successor in the order of the comparator");
+
+            lasd::FrozenSet<int, LastDigit> digits(lst);
+            Check(loctestnum, loctesterr, digits.Size() == 10 && digits.Exists(7) && digits.Exists(17), "One key per equivalence class of the comparator");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyFrozenSet tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Range queries su un set qualunque, confrontate con un std::set
+template <typename SetType>
+void RangeChecks(uint &loctestnum, uint &loctesterr, const string &name)
+{
+    SetType set;
+    std::set<int> ref;
+
+    for(int i = 0; i < 400; i++)
+    {
+        int val = (i * 7919) % 1000;
+        set.Insert(val);
+        ref.insert(val);
+    }
+
+    bool traverse = true, count = true;
+
+    for(int lo = -10; lo <= 1010; lo += 37)
+        for(int hi = lo - 5; hi <= 1010; hi += 53)
+        {
+            std::set<int> got, exp;
+
+            set.TraverseRange(lo, hi, [&got] (const int &dat) { got.insert(dat); });
+            if(lo <= hi)
+                exp.insert(ref.lower_bound(lo), ref.upper_bound(hi));
+
+            traverse = traverse && got == exp;
+            count = count && set.CountRange(lo, hi) == exp.size();
+        }
+
+    Check(loctestnum, loctesterr, traverse, name + ": TraverseRange on a grid of ranges");
+    Check(loctestnum, loctesterr, count, name + ": CountRange on a grid of ranges");
+
+    bool remove = true;
+    ulong seed = 777;
+
+    while(ref.size() > 0)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        int lo = static_cast<int>((seed >> 33) % 1100) - 50;
+        int hi = lo + static_cast<int>((seed >> 20) % 150);
+
+        ulong exp = std::distance(ref.lower_bound(lo), ref.upper_bound(hi));
+        ref.erase(ref.lower_bound(lo), ref.upper_bound(hi));
+
+        remove = remove && set.RemoveRange(lo, hi) == exp && SameAs(set, ref);
+    }
+
+    Check(loctestnum, loctesterr, remove, name + ": RemoveRange until empty");
+    Check(loctestnum, loctesterr, set.RemoveRange(0, 1000) == 0 && set.Empty(), name + ": RemoveRange on the empty set");
+
+    set.Insert(5);
+    set.Insert(1);
+    set.Insert(9);
+    Check(loctestnum, loctesterr, set.RemoveRange(9, 1) == 0 && set.Size() == 3, name + ": RemoveRange with first > last");
+    Check(loctestnum, loctesterr, set.RemoveRange(1, 9) == 3 && set.Empty(), name + ": RemoveRange of the whole set");
+
+    set.Insert(2);
+    Check(loctestnum, loctesterr, set.Min() == 2 && set.Max() == 2 && set.Size() == 1, name + ": Insert after a full RemoveRange");
+}
+
+void myset_range(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MySet range tests: ----------------------" << endl;
+
+        RangeChecks<lasd::SetVec<int>>(loctestnum, loctesterr, "SetVec");
+        RangeChecks<lasd::SetLst<int>>(loctestnum, loctesterr, "SetLst");
+
+        // Tipo non banalmente copiabile
+        {
+            lasd::SetVec<string> set;
+
+            for(string str : {"a", "b", "c", "d", "e", "f", "g"})
+                set.Insert(str);
+
+            Check(loctestnum, loctesterr, set.CountRange("b", "dd") == 3, "SetVec<string>: CountRange(\"b\", \"dd\") is 3");
+            Check(loctestnum, loctesterr, set.RemoveRange("b", "dd") == 3 && set.Successor("a") == "e", "SetVec<string>: RemoveRange(\"b\", \"dd\")");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MySet range tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Rank e Select su un set qualunque
+template <typename SetType>
+void RankChecks(uint &loctestnum, uint &loctesterr, const string &name)
+{
+    SetType set;
+    std::set<int> ref;
+
+    for(int i = 0; i < 300; i++)
+    {
+        int val = (i * 7919) % 900;
+        set.Insert(val);
+        ref.insert(val);
+    }
+
+    bool rank = true, select = true;
+
+    for(int key = -5; key <= 905; key++)
+        rank = rank && set.Rank(key) == static_cast<ulong>(std::distance(ref.begin(), ref.lower_bound(key)));
+
+    ulong i = 0;
+    for(int dat : ref)
+        select = select && set.Select(i++) == dat;
+
+    Check(loctestnum, loctesterr, rank, name + ": Rank on every key of the range");
+    Check(loctestnum, loctesterr, select, name + ": Select on every rank");
+    Check(loctestnum, loctesterr, set.Rank(set.Select(42)) == 42, name + ": Rank(Select(42)) is 42");
+
+    bool thrown = false;
+    try { set.Select(set.Size()); } catch(const std::out_of_range &) { thrown = true; }
+    Check(loctestnum, loctesterr, thrown, name + ": Select(Size()) throws out_of_range");
+
+    set.Clear();
+    thrown = false;
+    try { set.Select(0); } catch(const std::out_of_range &) { thrown = true; }
+    Check(loctestnum, loctesterr, thrown && set.Rank(7) == 0, name + ": Rank/Select on the empty set");
+}
+
+void myset_rank(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MySet rank tests: ----------------------" << endl;
+
+        RankChecks<lasd::SetVec<int>>(loctestnum, loctesterr, "SetVec");
+        RankChecks<lasd::SetLst<int>>(loctestnum, loctesterr, "SetLst");
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MySet rank tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+void myset_adaptive(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyAdaptiveSet tests: ----------------------" << endl;
+
+        // Passaggi di layout con isteresi (InlineCapacity 16, ritorno all'array inline a 8)
+        {
+            lasd::AdaptiveSet<int> set;
+
+            for(int i = 0; i < 16; i++)
+                set.Insert(i);
+            Check(loctestnum, loctesterr, set.Inlined() && set.Size() == 16, "16 keys stay inline");
+
+            set.Insert(16);
+            Check(loctestnum, loctesterr, !set.Inlined() && set.Size() == 17, "The 17th key moves the set to SetVec");
+
+            for(int i = 16; i > 8; i--)
+                set.Remove(i);
+            Check(loctestnum, loctesterr, !set.Inlined() && set.Size() == 9, "9 keys stay in SetVec (hysteresis)");
+
+            set.RemoveMax();
+            Check(loctestnum, loctesterr, set.Inlined() && set.Size() == 8, "8 keys go back inline");
+            Check(loctestnum, loctesterr, set.Min() == 0 && set.Max() == 7 && set.Predecessor(5) == 4, "Keys are preserved by the moves");
+
+            set.Insert(100);
+            set.Remove(100);
+            Check(loctestnum, loctesterr, set.Inlined(), "One insert and one remove do not move the set");
+        }
+
+        // Indice di sola lettura: costruito dopo molte letture, eliminato alla prima scrittura
+        {
+            lasd::AdaptiveSet<int> set;
+
+            for(int i = 0; i < 1000; i++)
+                set.Insert(2 * i);
+
+            bool found = true;
+            for(int i = 0; i < 300; i++)
+                found = found && set.Exists(2 * i) && !set.Exists(2 * i + 1);
+
+            Check(loctestnum, loctesterr, found && set.Indexed(), "Long read phase builds the index");
+            Check(loctestnum, loctesterr, set.Predecessor(501) == 500 && set.Successor(500) == 502, "Predecessor/Successor through the index");
+
+            set.Insert(501);
+            Check(loctestnum, loctesterr, !set.Indexed() && set.Successor(500) == 501, "A write drops the index");
+
+            lasd::AdaptiveSet<int> copy(set);
+            Check(loctestnum, loctesterr, copy == set, "Copy constructor");
+
+            set.Clear();
+            Check(loctestnum, loctesterr, set.Empty() && set.Inlined() && copy.Size() == 1001, "Clear");
+        }
+
+        // Letture concorrenti che attraversano la soglia: l'indice si costruisce una volta sola
+        {
+            lasd::AdaptiveSet<int> set(8, 64);
+
+            for(int i = 0; i < 4000; i++)
+                set.Insert(3 * i);
+
+            const lasd::AdaptiveSet<int> &shared = set;
+            std::atomic<bool> same = true;
+
+            lasd::Executor::Default().ParallelFor(16, [&shared, &same] (ulong chunk) {
+                for(int i = 0; i < 400; i++)
+                {
+                    int key = static_cast<int>(chunk) * 700 + i;
+
+                    if(shared.Exists(key) != (key % 3 == 0))
+                        same.store(false);
+                }
+            });
+
+            Check(loctestnum, loctesterr, same.load() && set.Indexed(), "Concurrent const lookups build the index and agree with the set");
+        }
+
+        // Sequenza pseudo-casuale contro std::set, attraversando piu' volte le soglie
+        {
+            lasd::AdaptiveSet<int, 8> set(3, 16);
+            std::set<int> ref;
+            ulong seed = 4242;
+            bool same = true;
+
+            for(uint step = 0; step < 3000; step++)
+            {
+                seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+                int val = static_cast<int>((seed >> 33) % 40);
+
+                if((step / 150) % 2 == 0 ? (seed >> 20) % 4 != 0 : (seed >> 20) % 4 == 0)
+                {
+                    set.Insert(val);
+                    ref.insert(val);
+                }
+                else
+                {
+                    set.Remove(val);
+                    ref.erase(val);
+                }
+
+                same = same && set.Exists(val) == (ref.count(val) == 1) && SameAs(set, ref);
+            }
+
+            Check(loctestnum, loctesterr, same, "Random inserts/removes with custom thresholds");
+        }
+
+        RangeChecks<lasd::AdaptiveSet<int>>(loctestnum, loctesterr, "AdaptiveSet");
+        RankChecks<lasd::AdaptiveSet<int>>(loctestnum, loctesterr, "AdaptiveSet");
+
+        // Stringhe
+        {
+            lasd::AdaptiveSet<string, 4> set;
+
+            for(string str : {"delta", "alfa", "echo", "charlie", "bravo"})
+                set.Insert(str);
+
+            Check(loctestnum, loctesterr, !set.Inlined() && set.Min() == "alfa", "AdaptiveSet<string>: promoted with 5 keys");
+            Check(loctestnum, loctesterr, set.MinNRemove() == "alfa" && set.MaxNRemove() == "echo", "AdaptiveSet<string>: MinNRemove/MaxNRemove");
+            Check(loctestnum, loctesterr, !set.Inlined() && set.Remove("delta") && set.Inlined(), "AdaptiveSet<string>: back inline at 2 keys");
+            Check(loctestnum, loctesterr, set[0] == "bravo" && set[1] == "charlie", "AdaptiveSet<string>: keys after the move");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyAdaptiveSet tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Confronta le stringhe ignorando maiuscole e minuscole
+struct NoCase {
+
+    bool operator()(const string &fst, const string &snd) const noexcept
+    {
+        return std::lexicographical_compare(fst.begin(), fst.end(), snd.begin(), snd.end(),
+                                            [] (char x, char y) { return std::tolower(x) < std::tolower(y); });
+    }
+
+};
+
+// Set in ordine decrescente confrontato con un std::set con lo stesso comparatore
+template <typename SetType>
+void CompareChecks(uint &loctestnum, uint &loctesterr, const string &name)
+{
+    SetType set;
+    std::set<int, std::greater<int>> ref;
+    bool insert = true;
+
+    for(int i = 0; i < 300; i++)
+    {
+        int val = (i * 7919) % 500;
+        insert = insert && set.Insert(val) == ref.insert(val).second;
+    }
+
+    Check(loctestnum, loctesterr, insert && SameAs(set, ref), name + ": Insert in descending order");
+    Check(loctestnum, loctesterr, set.Min() == *ref.begin() && set.Max() == *ref.rbegin(), name + ": Min is the greatest key, Max the smallest");
+
+    bool neighbours = true;
+
+    for(int key = 1; key < 499; key += 7)
+    {
+        auto succ = ref.upper_bound(key);
+        auto pred = ref.lower_bound(key);
+
+        if(succ != ref.end())
+            neighbours = neighbours && set.Successor(key) == *succ;
+        if(pred != ref.begin())
+            neighbours = neighbours && set.Predecessor(key) == *std::prev(pred);
+    }
+
+    Check(loctestnum, loctesterr, neighbours, name + ": Predecessor and Successor follow the comparator");
+
+    bool remove = true;
+
+    for(int val = 0; val < 500; val += 3)
+        remove = remove && set.Remove(val) == (ref.erase(val) == 1);
+
+    Check(loctestnum, loctesterr, remove && SameAs(set, ref), name + ": Remove");
+    Check(loctestnum, loctesterr, set.Exists(*ref.begin()) && !set.Exists(3) && set.CountRange(400, 300) == static_cast<ulong>(std::distance(ref.lower_bound(400), ref.upper_bound(300))), name + ": Exists and CountRange");
+}
+
+void myset_compare(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MySet compare tests: ----------------------" << endl;
+
+        CompareChecks<lasd::SetVec<int, std::greater<int>>>(loctestnum, loctesterr, "SetVec<int, greater>");
+        CompareChecks<lasd::SetLst<int, std::greater<int>>>(loctestnum, loctesterr, "SetLst<int, greater>");
+
+        // Costruzione in blocco e snapshot con lo stesso ordine
+        {
+            lasd::Vector<int> vec(1000);
+            std::set<int, std::greater<int>> ref;
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                ref.insert(vec[i] = static_cast<int>((i * 104729) % 600));
+
+            lasd::SetVec<int, std::greater<int>> set(vec);
+            lasd::FrozenSet<int, std::greater<int>> frozen = set.Freeze();
+
+            Check(loctestnum, loctesterr, SameAs(set, ref), "SetVec<int, greater>: built from a Vector");
+            Check(loctestnum, loctesterr, frozen.Min() == 599 && frozen.Successor(300) == 299 && frozen.Predecessor(300) == 301 && frozen.Exists(42), "FrozenSet<int, greater>: lookups in descending order");
+        }
+
+        // Chiavi equivalenti ma diverse: conta solo il comparatore
+        {
+            lasd::SetVec<string, NoCase> vset;
+            lasd::SetLst<string, NoCase> lset;
+
+            for(string str : {"Beta", "alpha", "GAMMA"})
+            {
+                vset.Insert(str);
+                lset.Insert(str);
+            }
+
+            Check(loctestnum, loctesterr, !vset.Insert("ALPHA") && vset.Exists("gamma") && vset.Min() == "alpha" && vset.Size() == 3, "SetVec<string, NoCase>: keys equal up to case");
+            Check(loctestnum, loctesterr, !lset.Insert("beta") && lset.Exists("BETA") && lset.Max() == "GAMMA" && lset.Size() == 3, "SetLst<string, NoCase>: keys equal up to case");
+            Check(loctestnum, loctesterr, vset.Remove("Gamma") && lset.Remove("aLpHa") && vset.Size() == 2 && lset.Size() == 2, "Set<string, NoCase>: Remove of an equivalent key");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MySet compare tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Run ordinate di lunghezze diverse (anche vuote) con valori ripetuti fra una run e l'altra
+bool RandomMerge(ulong runs)
+{
+    lasd::SortableVector<long> * vecs = new lasd::SortableVector<long>[runs];
+    std::vector<long> all;
+    lasd::KWayMerge<long> merge;
+    ulong seed = 99 + runs;
+
+    for(ulong r = 0; r < runs; r++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ulong length = (seed >> 50) % 300;
+
+        vecs[r].Resize(length);
+
+        for(ulong i = 0; i < length; i++)
+        {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            vecs[r][i] = static_cast<long>((seed >> 40) % 500);
+        }
+
+        vecs[r].Sort();
+
+        for(ulong i = 0; i < length; i++)
+            all.push_back(vecs[r][i]);
+
+        merge.Add(vecs[r]);
+    }
+
+    std::sort(all.begin(), all.end());
+
+    bool same = merge.Size() == all.size();
+    lasd::SortableVector<long> merged = merge.Merged();
+
+    for(ulong i = 0; same && i < all.size(); i++)
+        same = merged[i] == all[i];
+
+    same = same && merge.Empty();
+
+    merge.Rewind();
+    lasd::SetVec<long> set = merge.MergedSet();
+    std::set<long> ref(all.begin(), all.end());
+
+    same = same && SameAs(set, ref);
+
+    delete[] vecs;
+
+    return same;
+}
+
+struct Tagged {
+
+    int key = 0;
+    int run = 0;
+
+    bool operator==(const Tagged &) const noexcept = default;
+
+};
+
+struct TaggedOrder {
+
+    bool operator()(const Tagged &fst, const Tagged &snd) const noexcept { return fst.key < snd.key; }
+
+};
+
+void myset_merge(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MySet KWayMerge tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, RandomMerge(1) && RandomMerge(2) && RandomMerge(7) && RandomMerge(64) && RandomMerge(100), "KWayMerge<long>: Merged and MergedSet of random runs");
+
+        // Stabilita': a pari chiave prima gli elementi delle run aggiunte prima
+        {
+            lasd::Vector<Tagged> fst(3), snd(3), trd(2);
+
+            fst[0] = {1, 0}; fst[1] = {3, 0}; fst[2] = {3, 0};
+            snd[0] = {1, 1}; snd[1] = {2, 1}; snd[2] = {3, 1};
+            trd[0] = {0, 2}; trd[1] = {3, 2};
+
+            lasd::KWayMerge<Tagged, TaggedOrder> merge;
+            merge.Add(fst);
+            merge.Add(snd);
+            merge.Add(trd);
+
+            string order;
+
+            while(!merge.Empty())
+            {
+                Tagged front = merge.FrontNRemove();
+                order += to_string(front.key) + to_string(front.run) + " ";
+            }
+
+            Check(loctestnum, loctesterr, order == "02 10 11 21 30 30 31 32 ", "KWayMerge: equal keys in the order of the runs");
+        }
+
+        // Run eterogenee (SetVec, SortableVector, List), Drain senza duplicati, comparatore invertito
+        {
+            lasd::SetVec<string, std::greater<string>> set;
+            set.Insert("kilo");
+            set.Insert("alfa");
+            set.Insert("zulu");
+
+            lasd::List<string> lst;
+            lst.InsertAtBack("mike");
+            lst.InsertAtBack("kilo");
+            lst.InsertAtBack("bravo");
+
+            lasd::KWayMerge<string, std::greater<string>> merge;
+            merge.Add(set);
+            merge.Add(lst);
+
+            Check(loctestnum, loctesterr, merge.Runs() == 2 && merge.Size() == 6 && merge.Front() == "zulu", "KWayMerge<string, greater>: the greatest first");
+
+            string drained;
+            merge.Drain([&drained] (const string &curr) { drained += curr + " "; }, true);
+            Check(loctestnum, loctesterr, drained == "zulu mike kilo bravo alfa " && merge.Empty(), "KWayMerge<string, greater>: Drain without duplicates");
+
+            merge.Rewind();
+            merge.RemoveFromFront();
+
+            lasd::KWayMerge<string, std::greater<string>> copy(merge);
+            copy.RemoveFromFront();
+            Check(loctestnum, loctesterr, merge.Front() == "mike" && copy.Front() == "kilo" && copy.Size() == 4, "Copy constructor: same runs, own progress");
+
+            lasd::SetVec<string, std::greater<string>> result = copy.MergedSet();
+            Check(loctestnum, loctesterr, result.Size() == 3 && result.Min() == "kilo" && result.Max() == "alfa", "KWayMerge<string, greater>: MergedSet of the elements left");
+
+            lasd::KWayMerge<string, std::greater<string>> moved(std::move(merge));
+            Check(loctestnum, loctesterr, merge.Empty() && merge.Runs() == 0 && moved.Size() == 5, "Move constructor");
+
+            moved.Clear();
+            Check(loctestnum, loctesterr, moved.Empty() && moved.Runs() == 0 && moved.Merged().Empty(), "Clear drops the runs");
+
+            try
+            {
+                moved.Front();
+                Check(loctestnum, loctesterr, false, "Front of an empty KWayMerge must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Front of an empty KWayMerge throws length_error");
+            }
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MySet KWayMerge tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+}
+
+/* ************************************************************************** */
+
+void mysetext_test(uint &testnum, uint &testerr)
+{
+    mysetvec_ring(testnum, testerr);
+    mysetvec_search(testnum, testerr);
+    mysetfrozen(testnum, testerr);
+    myset_range(testnum, testerr);
+    myset_rank(testnum, testerr);
+    myset_adaptive(testnum, testerr);
+    myset_compare(testnum, testerr);
+    myset_merge(testnum, testerr);
+}
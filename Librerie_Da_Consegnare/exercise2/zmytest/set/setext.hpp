@@ -0,0 +1,6 @@
+#ifndef __SETEXT_H__
+#define __SETEXT_H__
+
+void mysetext_test(unsigned int &, unsigned int &);
+
+#endif // __SETEXT_H__
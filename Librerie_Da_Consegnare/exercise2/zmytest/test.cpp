@@ -14,6 +14,14 @@
 #include "heap/heapvec.hpp"
 #include "pq/pqheap.hpp"
 
+#include "vector/vectorext.hpp"
+#include "set/setext.hpp"
+#include "heap/heapext.hpp"
+#include "pq/pqext.hpp"
+
+#include "map/mapvec.hpp"
+#include "map/maphash.hpp"
+
 /* ************************************************************************** */
 
 using namespace std;
@@ -56,6 +64,16 @@ void MyTestExercise2B()
     check(mypqhp_test);
 }
 
+void MyTestExtra()
+{
+    check(myvectorext_test);
+    check(mysetext_test);
+    check(myheapext_test);
+    check(mypqext_test);
+    check(mymapvec_test);
+    check(mymaphash_test);
+}
+
 void mytest()
 {
     cout << endl << "---------------------- STARTING MyTests ...----------------------" << endl;
@@ -101,6 +119,17 @@ void mytest()
     cout << endl << "---------------------- END OF MyTestExercise2B ---------------------- " << endl;
 
 
+    testnum = testerr = 0;
+
+
+    cout << endl << "---------------------- STARTING MyTestExtra ----------------------" << endl;
+    MyTestExtra();
+    cout << endl << "MyTestExtra: Errors/Tests: " << testerr << "/" << testnum << endl;
+    uint testnum5 = testnum;
+    uint testerr5 = testerr;
+    cout << endl << "---------------------- END OF MyTestExtra ---------------------- " << endl;
+
+
     testnum = testerr = 0;
 
     cout << endl << "---------------------- SUMMARY OF ALL TESTS ----------------------" << endl;
@@ -113,5 +142,7 @@ void mytest()
     cout << endl << "MyTestExercise2B: Errors/Tests: " << testerr4 << "/" << testnum4 << endl;
     cout << endl << "Total Errors Exercise2: Errors/Tests: " << testerr3 + testerr4 << "/" << testnum3 + testnum4 << endl;
 
+    cout << endl << "MyTestExtra: Errors/Tests: " << testerr5 << "/" << testnum5 << endl;
+
     cout << endl << "---------------------- END OF MyTests ----------------------" << endl;
 }
\ No newline at end of file
@@ -0,0 +1,809 @@
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+/* ************************************************************************** */
+
+#include "../../zlasdtest/container/container.hpp"
+
+#include "../check.hpp"
+
+/* ************************************************************************** */
+
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+/* ************************************************************************** */
+
+// Tipi e funzioni di supporto: linkage interno, cosi' non si scontrano con quelli degli altri file di test
+namespace {
+
+// Find/Count/Exists confrontati con una scansione scalare, per ogni lunghezza fino a 300
+template <typename Data>
+bool SearchMatches()
+{
+    lasd::Vector<Data> vec(300);
+
+    for(ulong i = 0; i < 300; i++)
+        vec[i] = static_cast<Data>((i * 31) % 41);
+
+    bool correct = true;
+
+    for(ulong length = 0; length <= 300; length += 13)
+    {
+        lasd::Vector<Data> part(vec);
+        part.Resize(length);
+
+        for(int key = -1; key <= 41; key++)
+        {
+            ulong first = length, count = 0;
+
+            for(ulong i = 0; i < length; i++)
+                if(part[i] == static_cast<Data>(key))
+                {
+                    first = (first == length) ? i : first;
+                    count++;
+                }
+
+            correct = correct && part.Find(static_cast<Data>(key)) == first
+                              && part.Count(static_cast<Data>(key)) == count
+                              && part.Exists(static_cast<Data>(key)) == (count > 0);
+        }
+    }
+
+    return correct;
+}
+
+void myvector_search(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyVector search tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, SearchMatches<int8_t>(), "Vector<int8_t>: Find/Count/Exists");
+        Check(loctestnum, loctesterr, SearchMatches<short>(), "Vector<short>: Find/Count/Exists");
+        Check(loctestnum, loctesterr, SearchMatches<int>(), "Vector<int>: Find/Count/Exists");
+        Check(loctestnum, loctesterr, SearchMatches<long>(), "Vector<long>: Find/Count/Exists");
+        Check(loctestnum, loctesterr, SearchMatches<float>(), "Vector<float>: Find/Count/Exists");
+        Check(loctestnum, loctesterr, SearchMatches<double>(), "Vector<double>: Find/Count/Exists");
+
+        // Corsie da 8 bit: il conteggio supera la capacita' di una corsia
+        {
+            lasd::Vector<char> vec(100000);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i] = (i % 2 == 0) ? 'a' : 'b';
+
+            Check(loctestnum, loctesterr, vec.Count('a') == 50000 && vec.Count('c') == 0, "Vector<char>: Count over 100000 elements");
+        }
+
+        // Tipo non aritmetico: percorso scalare
+        {
+            lasd::Vector<string> vec(5);
+
+            vec[0] = "A"; vec[1] = "B"; vec[2] = "A"; vec[3] = "C"; vec[4] = "A";
+
+            Check(loctestnum, loctesterr, vec.Find("C") == 3 && vec.Find("D") == 5, "Vector<string>: Find");
+            Check(loctestnum, loctesterr, vec.Count("A") == 3 && vec.Exists("B") && !vec.Exists("D"), "Vector<string>: Count/Exists");
+        }
+
+        // Vettore vuoto
+        {
+            lasd::Vector<double> vec;
+
+            Check(loctestnum, loctesterr, vec.Find(1.0) == 0 && vec.Count(1.0) == 0 && !vec.Exists(1.0), "Empty vector: Find/Count/Exists");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyVector search tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Riduzioni e trasformazioni confrontate con un ciclo scalare, per ogni lunghezza fino a 300
+// (valori interi piccoli: anche per float e double le somme sono esatte in qualunque ordine)
+template <typename Data>
+bool ArithmeticMatches()
+{
+    bool correct = true;
+
+    for(ulong length = 1; length <= 300; length += 7)
+    {
+        lasd::Vector<Data> vec(length), other(length);
+
+        for(ulong i = 0; i < length; i++)
+        {
+            vec[i] = static_cast<Data>(static_cast<long>((i * 37) % 101) - 50);
+            other[i] = static_cast<Data>(i % 3);
+        }
+
+        Data sum = 0, dot = 0, min = vec[0], max = vec[0];
+
+        for(ulong i = 0; i < length; i++)
+        {
+            sum += vec[i];
+            dot += vec[i] * other[i];
+            min = (vec[i] < min) ? vec[i] : min;
+            max = (vec[i] > max) ? vec[i] : max;
+        }
+
+        correct = correct && vec.Sum() == sum && vec.Dot(other) == dot
+                          && vec.Min() == min && vec.Max() == max
+                          && vec.MinMax() == std::make_pair(min, max);
+
+        lasd::Vector<Data> copy(vec);
+        copy.Clamp(static_cast<Data>(-20), static_cast<Data>(20));
+        copy.Scale(static_cast<Data>(2));
+        copy.Add(other);
+
+        for(ulong i = 0; i < length; i++)
+        {
+            Data clamped = (vec[i] < -20) ? -20 : ((vec[i] > 20) ? 20 : vec[i]);
+            correct = correct && copy[i] == static_cast<Data>(clamped * 2 + other[i]);
+        }
+    }
+
+    return correct;
+}
+
+void myvector_arithmetic(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyVector arithmetic tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, ArithmeticMatches<short>(), "Vector<short>: Sum/MinMax/Dot/Scale/Add/Clamp");
+        Check(loctestnum, loctesterr, ArithmeticMatches<int>(), "Vector<int>: Sum/MinMax/Dot/Scale/Add/Clamp");
+        Check(loctestnum, loctesterr, ArithmeticMatches<long>(), "Vector<long>: Sum/MinMax/Dot/Scale/Add/Clamp");
+        Check(loctestnum, loctesterr, ArithmeticMatches<float>(), "Vector<float>: Sum/MinMax/Dot/Scale/Add/Clamp");
+        Check(loctestnum, loctesterr, ArithmeticMatches<double>(), "Vector<double>: Sum/MinMax/Dot/Scale/Add/Clamp");
+
+        // Somma riassociata: su valori non rappresentabili esattamente resta vicina a quella sequenziale
+        {
+            lasd::SortableVector<double> vec(10000);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i] = 0.1 * static_cast<double>(i % 10);
+
+            double sequential = vec.Fold<double>([] (const double &dat, const double &acc) { return acc + dat; }, 0.0);
+
+            Check(loctestnum, loctesterr, std::abs(vec.Sum() - sequential) < 1e-9, "SortableVector<double>: Sum close to the sequential Fold");
+        }
+
+        // Vettore vuoto e dimensioni diverse
+        {
+            lasd::Vector<int> empty, vec(3), other(4);
+
+            Check(loctestnum, loctesterr, empty.Sum() == 0, "Empty vector: Sum");
+
+            try
+            {
+                empty.Min();
+                Check(loctestnum, loctesterr, false, "Empty vector: Min must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Empty vector: Min throws");
+            }
+
+            try
+            {
+                vec.Dot(other);
+                Check(loctestnum, loctesterr, false, "Different sizes: Dot must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Different sizes: Dot throws");
+            }
+
+            try
+            {
+                vec.Add(other);
+                Check(loctestnum, loctesterr, false, "Different sizes: Add must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Different sizes: Add throws");
+            }
+
+            try
+            {
+                vec.Clamp(2, 1);
+                Check(loctestnum, loctesterr, false, "Empty interval: Clamp must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "Empty interval: Clamp throws");
+            }
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyVector arithmetic tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Conta le copie, che (come per string) possono lanciare: gli algoritmi noexcept devono solo
+// spostare gli elementi
+struct CopyCounted {
+
+    inline static std::atomic<ulong> copies = 0;
+
+    long key = 0;
+
+    CopyCounted() = default;
+    CopyCounted(const CopyCounted &other) : key(other.key) { copies++; }
+    CopyCounted(CopyCounted &&) noexcept = default;
+
+    CopyCounted &operator=(const CopyCounted &other) { key = other.key; copies++; return *this; }
+    CopyCounted &operator=(CopyCounted &&) noexcept = default;
+
+    bool operator<(const CopyCounted &other) const noexcept { return key < other.key; }
+    bool operator>(const CopyCounted &other) const noexcept { return key > other.key; }
+    bool operator==(const CopyCounted &other) const noexcept { return key == other.key; }
+
+};
+
+void myvector_parallel(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyVector parallel tests: ----------------------" << endl;
+
+        lasd::Executor exec(3);
+        lasd::Executor single(0);
+
+        Check(loctestnum, loctesterr, exec.Threads() == 4 && single.Threads() == 1, "Executor: Threads");
+
+        // Tutti gli indici vengono eseguiti una sola volta
+        {
+            std::atomic<ulong> calls = 0, total = 0;
+
+            exec.ParallelFor(1000, [&calls, &total] (ulong index) { calls++; total += index; });
+
+            Check(loctestnum, loctesterr, calls == 1000 && total == 499500, "Executor: ParallelFor runs every index once");
+        }
+
+        // Le eccezioni dei task arrivano al chiamante
+        try
+        {
+            exec.ParallelFor(10, [] (ulong index) { if(index == 7) throw std::length_error("task"); });
+            Check(loctestnum, loctesterr, false, "Executor: ParallelFor must rethrow");
+        }
+        catch(std::length_error &)
+        {
+            Check(loctestnum, loctesterr, true, "Executor: ParallelFor rethrows");
+        }
+
+        // Chiamate annidate dai worker
+        {
+            std::atomic<ulong> calls = 0;
+
+            exec.ParallelFor(8, [&exec, &calls] (ulong) { exec.ParallelFor(8, [&calls] (ulong) { calls++; }); });
+
+            Check(loctestnum, loctesterr, calls == 64, "Executor: nested ParallelFor");
+        }
+
+        // Fork/join ricorsivo con Spawn/Sync
+        {
+            std::function<ulong(ulong)> fib = [&exec, &fib] (ulong n) -> ulong {
+                if(n < 2)
+                    return n;
+
+                ulong left = 0;
+                lasd::Executor::TaskGroup group;
+
+                exec.Spawn(group, [&fib, &left, n] { left = fib(n - 1); });
+                ulong right = fib(n - 2);
+                exec.Sync(group);
+
+                return left + right;
+            };
+
+            Check(loctestnum, loctesterr, fib(20) == 6765, "Executor: recursive Spawn/Sync");
+        }
+
+        // Le eccezioni dei task arrivano a Sync
+        try
+        {
+            lasd::Executor::TaskGroup group;
+
+            exec.Spawn(group, [] { throw std::out_of_range("task"); });
+            exec.Spawn(group, [] {});
+            exec.Sync(group);
+
+            Check(loctestnum, loctesterr, false, "Executor: Sync must rethrow");
+        }
+        catch(std::out_of_range &)
+        {
+            Check(loctestnum, loctesterr, true, "Executor: Sync rethrows");
+        }
+
+        // Un gruppo lasciato da un'eccezione, senza Sync, aspetta comunque i suoi task
+        {
+            std::atomic<ulong> done = 0;
+
+            try
+            {
+                lasd::Executor::TaskGroup group;
+
+                for(ulong i = 0; i < 8; i++)
+                    exec.Spawn(group, [&done] {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        done++;
+                    });
+
+                throw std::length_error("caller");
+            }
+            catch(std::length_error &)
+            {
+            }
+
+            Check(loctestnum, loctesterr, done == 8, "Executor: a TaskGroup left by an exception waits for its tasks");
+        }
+
+        // Ordinamento: vettori casuali, con molti duplicati, gia' ordinati e al contrario
+        for(ulong length : {0UL, 1UL, 17UL, 1000UL, 100000UL})
+        {
+            bool correct = true;
+
+            for(ulong kind = 0; kind < 4; kind++)
+            {
+                lasd::SortableVector<long> vec(length), other(length);
+                ulong seed = 12345;
+
+                for(ulong i = 0; i < length; i++)
+                {
+                    seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+                    long value = (kind == 0) ? static_cast<long>(seed >> 33) : (kind == 1) ? static_cast<long>((seed >> 33) % 7)
+                               : (kind == 2) ? static_cast<long>(i) : static_cast<long>(length - i);
+                    vec[i] = other[i] = value;
+                }
+
+                vec.Sort(exec);
+                other.Sort(single);
+
+                long sum = 0, otherSum = 0;
+
+                for(ulong i = 0; i < length; i++)
+                {
+                    correct = correct && (i == 0 || !(vec[i] < vec[i - 1])) && vec[i] == other[i];
+                    sum += vec[i];
+                    otherSum += (kind == 0) ? 0 : (kind == 1) ? 0 : (kind == 2) ? static_cast<long>(i) : static_cast<long>(length - i);
+                }
+
+                correct = correct && (kind < 2 || sum == otherSum);
+            }
+
+            Check(loctestnum, loctesterr, correct, "SortableVector<long> (" + to_string(length) + "): Sort on 1 and 4 threads");
+        }
+
+        {
+            lasd::SortableVector<string> vec(5000);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i] = to_string((i * 7919) % 5000);
+
+            vec.Sort();
+
+            bool correct = true;
+
+            for(ulong i = 1; i < vec.Size(); i++)
+                correct = correct && vec[i - 1] < vec[i];
+
+            Check(loctestnum, loctesterr, correct, "SortableVector<string>: Sort on the default executor");
+        }
+
+        // Il pivot resta nell'array: nessuna copia che possa lanciare dentro Sort() noexcept
+        {
+            lasd::SortableVector<CopyCounted> vec(100000);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i].key = static_cast<long>((i * 7919) % 1000);
+
+            CopyCounted::copies = 0;
+            vec.Sort(exec);
+
+            bool correct = CopyCounted::copies == 0;
+
+            for(ulong i = 1; i < vec.Size(); i++)
+                correct = correct && !(vec[i] < vec[i - 1]);
+
+            Check(loctestnum, loctesterr, correct, "SortableVector: Sort moves the elements and never copies them");
+        }
+
+        for(ulong length : {0UL, 1UL, 1000UL, 300000UL})
+        {
+            lasd::SortableVector<long> vec(length);
+
+            for(ulong i = 0; i < length; i++)
+                vec[i] = static_cast<long>(i);
+
+            lasd::SortableVector<long> copy(vec);
+            copy.ParallelMap([] (long &dat) { dat = 2 * dat + 1; }, exec);
+            vec.Map([] (long &dat) { dat = 2 * dat + 1; });
+
+            long expected = vec.Fold<long>([] (const long &dat, const long &acc) { return acc + dat; }, 0);
+
+            Check(loctestnum, loctesterr, copy == vec, "SortableVector<long> (" + to_string(length) + "): ParallelMap");
+            Check(loctestnum, loctesterr,
+                  vec.ParallelFold<long>([] (const long &dat, const long &acc) { return acc + dat; },
+                                         [] (const long &left, const long &right) { return left + right; }, 0, exec) == expected,
+                  "SortableVector<long> (" + to_string(length) + "): ParallelFold");
+            Check(loctestnum, loctesterr,
+                  vec.ParallelExists(static_cast<long>(2 * length - 1), exec) == (length > 0) && !vec.ParallelExists(0, exec),
+                  "SortableVector<long> (" + to_string(length) + "): ParallelExists");
+        }
+
+        // Accumulatore non commutativo: i parziali si combinano nell'ordine degli indici
+        {
+            lasd::Vector<string> vec(100000);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i] = string(1, static_cast<char>('a' + i % 26));
+
+            string sequential = vec.Fold<string>([] (const string &dat, const string &acc) { return acc + dat; }, "");
+            string parallel = vec.ParallelFold<string>([] (const string &dat, const string &acc) { return acc + dat; },
+                                                       [] (const string &left, const string &right) { return left + right; }, "", exec);
+
+            Check(loctestnum, loctesterr, parallel == sequential, "Vector<string>: ParallelFold keeps the order");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyVector parallel tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Valori con pochi o molti duplicati (modulo), confrontati con un std::vector ordinato
+lasd::SortableVector<long> SelectInput(ulong length, ulong modulo, ulong seed, std::vector<long> &ref)
+{
+    lasd::SortableVector<long> vec(length);
+    ref.resize(length);
+
+    for(ulong i = 0; i < length; i++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        vec[i] = ref[i] = static_cast<long>((seed >> 33) % modulo);
+    }
+
+    std::sort(ref.begin(), ref.end());
+
+    return vec;
+}
+
+// Dopo NthElement(k): l'elemento giusto in k, nessuno maggiore prima e nessuno minore dopo
+bool NthMatches(ulong length, ulong modulo)
+{
+    bool same = true;
+
+    for(ulong k : {0UL, length / 3, length / 2, length - 1})
+    {
+        std::vector<long> ref;
+        lasd::SortableVector<long> vec = SelectInput(length, modulo, 7 * length + k, ref);
+
+        long nth = vec.NthElement(k);
+        same = same && nth == ref[k] && vec[k] == ref[k];
+
+        for(ulong i = 0; same && i < length; i++)
+            same = (i < k) ? vec[i] <= nth : vec[i] >= nth;
+    }
+
+    return same;
+}
+
+bool PartialMatches(ulong length, ulong count)
+{
+    std::vector<long> ref;
+    lasd::SortableVector<long> vec = SelectInput(length, length, length + count, ref);
+
+    vec.PartialSort(count);
+
+    bool same = true;
+
+    for(ulong i = 0; same && i < length; i++)
+        same = (i < count) ? vec[i] == ref[i] : vec[i] >= ref[count - 1];
+
+    return same;
+}
+
+void myvector_select(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyVector selection tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, NthMatches(1, 10) && NthMatches(15, 1000) && NthMatches(500, 1000), "SortableVector<long>: NthElement on short vectors");
+        Check(loctestnum, loctesterr, NthMatches(100000, 1000000000) && NthMatches(70001, 1000), "SortableVector<long>: NthElement with sampled pivots");
+        Check(loctestnum, loctesterr, NthMatches(50000, 1) && NthMatches(50000, 2), "SortableVector<long>: NthElement with all (or almost all) values equal");
+        Check(loctestnum, loctesterr, PartialMatches(1000, 1) && PartialMatches(100000, 100) && PartialMatches(5000, 5000), "SortableVector<long>: PartialSort");
+
+        // Percentili nearest-rank su 1..1000 in ordine sparso, richiesti in ordine qualsiasi e ripetuti
+        {
+            lasd::SortableVector<long> vec(1000);
+
+            for(ulong i = 0; i < 1000; i++)
+                vec[i] = static_cast<long>((i * 7919) % 1000) + 1;
+
+            lasd::Vector<long> result = vec.Percentiles({99.9, 50, 90, 0, 100, 99, 50, 0.05});
+            Check(loctestnum, loctesterr, result.Size() == 8 && result[0] == 999 && result[1] == 500 && result[2] == 900 && result[3] == 1 && result[4] == 1000 && result[5] == 990 && result[6] == 500 && result[7] == 1, "SortableVector<long>: Percentiles");
+
+            bool placed = true;
+
+            for(ulong rank : {0UL, 499UL, 899UL, 989UL, 998UL, 999UL})
+                placed = placed && vec[rank] == static_cast<long>(rank) + 1;
+
+            Check(loctestnum, loctesterr, placed, "Percentiles leaves every requested rank in its position");
+        }
+
+        // Il pivot della selezione resta nell'array: nessuna copia che possa lanciare dentro SelectRange noexcept
+        {
+            lasd::SortableVector<CopyCounted> vec(100000);
+
+            for(ulong i = 0; i < vec.Size(); i++)
+                vec[i].key = static_cast<long>((i * 7919) % 100000);
+
+            CopyCounted::copies = 0;
+            bool correct = vec.NthElement(31415).key == 31415;
+            vec.PartialSort(1000);
+
+            for(ulong i = 0; i < 1000; i++)
+                correct = correct && vec[i].key == static_cast<long>(i);
+
+            Check(loctestnum, loctesterr, correct && CopyCounted::copies == 0, "SortableVector: NthElement and PartialSort move the elements and never copy them");
+        }
+
+        // Percentili su molti campioni contro l'ordinamento completo
+        {
+            std::vector<long> ref;
+            lasd::SortableVector<long> vec = SelectInput(300000, 1000000, 4242, ref);
+
+            lasd::Vector<double> percentiles(4);
+            percentiles[0] = 50;
+            percentiles[1] = 90;
+            percentiles[2] = 99;
+            percentiles[3] = 99.9;
+
+            lasd::Vector<long> result = vec.Percentiles(percentiles);
+            Check(loctestnum, loctesterr, result[0] == ref[149999] && result[1] == ref[269999] && result[2] == ref[296999] && result[3] == ref[299699], "SortableVector<long>: p50/p90/p99/p999 of 300000 samples");
+        }
+
+        // Stringhe ed eccezioni
+        {
+            lasd::SortableVector<string> vec(5);
+            vec[0] = "kilo";
+            vec[1] = "alfa";
+            vec[2] = "zulu";
+            vec[3] = "mike";
+            vec[4] = "bravo";
+
+            Check(loctestnum, loctesterr, vec.NthElement(2) == "kilo" && vec[2] == "kilo", "SortableVector<string>: NthElement");
+
+            vec.PartialSort(2);
+            Check(loctestnum, loctesterr, vec[0] == "alfa" && vec[1] == "bravo", "SortableVector<string>: PartialSort");
+
+            try
+            {
+                vec.NthElement(5);
+                Check(loctestnum, loctesterr, false, "NthElement out of range must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "NthElement out of range throws out_of_range");
+            }
+
+            try
+            {
+                vec.Percentiles({50, 100.5});
+                Check(loctestnum, loctesterr, false, "A percentile above 100 must throw");
+            }
+            catch(std::out_of_range &)
+            {
+                Check(loctestnum, loctesterr, true, "A percentile above 100 throws out_of_range");
+            }
+
+            Check(loctestnum, loctesterr, vec.Percentiles(lasd::Vector<double>()).Size() == 0, "No percentiles requested, empty result");
+
+            try
+            {
+                lasd::SortableVector<string> empty;
+                empty.Percentiles({50});
+                Check(loctestnum, loctesterr, false, "Percentiles of an empty vector must throw");
+            }
+            catch(std::length_error &)
+            {
+                Check(loctestnum, loctesterr, true, "Percentiles of an empty vector throws length_error");
+            }
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyVector selection tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+/* ************************************************************************** */
+
+// Chiave e ordine di arrivo: il confronto guarda solo la chiave, cosi' si vede la stabilita'
+struct Sequenced {
+
+    long key = 0;
+    ulong seq = 0;
+
+    bool operator<(const Sequenced &other) const noexcept { return key < other.key; }
+    bool operator>(const Sequenced &other) const noexcept { return key > other.key; }
+    bool operator==(const Sequenced &other) const noexcept { return key == other.key && seq == other.seq; }
+
+};
+
+// shape: 0 casuale, 1 crescente, 2 decrescente, 3 quasi ordinato, 4 a denti di sega, 5 a piramide
+bool StableMatches(ulong length, ulong modulo, uint shape)
+{
+    lasd::SortableVector<Sequenced> vec(length);
+    std::vector<Sequenced> ref(length);
+    ulong seed = length * 31 + shape;
+
+    for(ulong i = 0; i < length; i++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        long random = static_cast<long>((seed >> 33) % modulo);
+
+        switch(shape)
+        {
+            case 1: ref[i].key = static_cast<long>(i / (1 + length / modulo)); break;
+            case 2: ref[i].key = static_cast<long>((length - i) / (1 + length / modulo)); break;
+            case 3: ref[i].key = (random < static_cast<long>(modulo / 50)) ? random : static_cast<long>(i); break;
+            case 4: ref[i].key = static_cast<long>(i % 1000) + random % 3; break;
+            case 5: ref[i].key = static_cast<long>(std::min(i, length - i)); break;
+            default: ref[i].key = random;
+        }
+
+        ref[i].seq = i;
+        vec[i] = ref[i];
+    }
+
+    vec.StableSort();
+    std::stable_sort(ref.begin(), ref.end());
+
+    bool same = true;
+
+    for(ulong i = 0; same && i < length; i++)
+        same = vec[i] == ref[i];
+
+    return same;
+}
+
+bool StableShapes(ulong length, ulong modulo)
+{
+    bool same = true;
+
+    for(uint shape = 0; same && shape < 6; shape++)
+        same = StableMatches(length, modulo, shape);
+
+    return same;
+}
+
+void myvector_stablesort(uint &testnum, uint &testerr)
+{
+    uint loctestnum = 0;
+    uint loctesterr = 0;
+
+    try
+    {
+        cout << endl << "---------------------- Begin of MyVector stable sort tests: ----------------------" << endl;
+
+        Check(loctestnum, loctesterr, StableShapes(0, 10) && StableShapes(1, 10) && StableShapes(2, 10) && StableShapes(63, 10) && StableShapes(64, 10) && StableShapes(65, 1000), "SortableVector<Sequenced>: StableSort on short vectors");
+        Check(loctestnum, loctesterr, StableShapes(1000, 1000000) && StableShapes(100000, 1000000000), "SortableVector<Sequenced>: StableSort with distinct keys");
+        Check(loctestnum, loctesterr, StableShapes(100000, 4) && StableShapes(100003, 100) && StableMatches(50000, 1, 0), "SortableVector<Sequenced>: StableSort keeps the order of equal keys");
+
+        // Un milione di elementi in blocchi ordinati alternati a blocchi casuali: fusioni lunghe e galoppo
+        {
+            const ulong length = 1000000;
+            lasd::SortableVector<long> vec(length);
+            ulong seed = 99;
+
+            for(ulong i = 0; i < length; i++)
+            {
+                seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+                vec[i] = ((i / 4096) % 2 == 0) ? static_cast<long>(i) : static_cast<long>(seed >> 44);
+            }
+
+            lasd::SortableVector<long> copy(vec);
+            vec.StableSort();
+            copy.Sort();
+
+            Check(loctestnum, loctesterr, vec == copy, "SortableVector<long>: StableSort agrees with Sort");
+        }
+
+        {
+            lasd::SortableVector<string> vec(6);
+            vec[0] = "delta";
+            vec[1] = "alfa";
+            vec[2] = "charlie";
+            vec[3] = "bravo";
+            vec[4] = "alfa";
+            vec[5] = "echo";
+
+            vec.StableSort();
+            Check(loctestnum, loctesterr, vec[0] == "alfa" && vec[1] == "alfa" && vec[2] == "bravo" && vec[3] == "charlie" && vec[4] == "delta" && vec[5] == "echo", "SortableVector<string>: StableSort");
+
+            vec.StableSort();
+            Check(loctestnum, loctesterr, vec[0] == "alfa" && vec[5] == "echo", "SortableVector<string>: StableSort of a sorted vector");
+        }
+    }
+    catch(...)
+    {
+        loctestnum++;
+        loctesterr++;
+        cout << endl << "../Unmanaged error! " << endl;
+    }
+
+    cout << endl << "---------------------- End of MyVector stable sort tests! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+}
+
+}
+
+/* ************************************************************************** */
+
+void myvectorext_test(uint &testnum, uint &testerr)
+{
+    myvector_search(testnum, testerr);
+    myvector_arithmetic(testnum, testerr);
+    myvector_parallel(testnum, testerr);
+    myvector_select(testnum, testerr);
+    myvector_stablesort(testnum, testerr);
+}
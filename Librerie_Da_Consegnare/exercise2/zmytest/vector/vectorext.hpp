@@ -0,0 +1,6 @@
+#ifndef __VECTOREXT_H__
+#define __VECTOREXT_H__
+
+void myvectorext_test(unsigned int &, unsigned int &);
+
+#endif // __VECTOREXT_H__